@@ -0,0 +1,58 @@
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace memory {
+
+Arena::~Arena()
+{
+    for(auto it = destructors_.rbegin(); it != destructors_.rend(); ++it)
+    {
+        it->destroy(it->object);
+    }
+}
+
+void* Arena::Allocate(size_t size, size_t alignment)
+{
+    size_t padding = (alignment - reinterpret_cast<uintptr_t>(current_) % alignment) % alignment;
+    if(current_ == nullptr || padding + size > available_)
+    {
+        AddBlock(size + alignment);
+        padding = (alignment - reinterpret_cast<uintptr_t>(current_) % alignment) % alignment;
+    }
+
+    char* result = current_ + padding;
+    current_ += padding + size;
+    available_ -= padding + size;
+    allocated_size_ += size;
+
+    return result;
+}
+
+std::string_view Arena::CopyString(std::string_view str)
+{
+    char* data = static_cast<char*>(Allocate(str.size(), 1));
+    std::memcpy(data, str.data(), str.size());
+
+    return {data, str.size()};
+}
+
+size_t Arena::GetAllocatedSize() const
+{
+    return allocated_size_;
+}
+
+void Arena::AddBlock(size_t min_size)
+{
+    // Блоки растут вдвое, пока не дойдут до MAX_BLOCK_SIZE, поэтому их немного даже на больших базах
+    const size_t size = std::max(block_size_, min_size);
+    block_size_ = std::min(block_size_ * 2, MAX_BLOCK_SIZE);
+
+    blocks_.emplace_back(new char[size]);
+    current_ = blocks_.back().get();
+    available_ = size;
+}
+
+} // namespace memory
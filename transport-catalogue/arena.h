@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace memory {
+
+// Арена: память выделяется большими блоками подряд и освобождается разом вместе с ареной.
+// Деструкторы созданных в арене объектов вызываются там же, в обратном порядке
+class Arena
+{
+public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena();
+
+    void* Allocate(size_t size, size_t alignment);
+
+    template <typename T, typename... Args>
+    T* Create(Args&&... args);
+
+    std::string_view CopyString(std::string_view str);
+
+    size_t GetAllocatedSize() const;
+
+private:
+    static constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+    static constexpr size_t MAX_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    struct Destructor
+    {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    void AddBlock(size_t min_size);
+
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t block_size_ = MIN_BLOCK_SIZE;
+    char* current_ = nullptr;
+    size_t available_ = 0;
+    size_t allocated_size_ = 0;
+    std::vector<Destructor> destructors_;
+};
+
+// Аллокатор для контейнеров внутри арены: освобождение ничего не делает,
+// память вернётся вместе со всей ареной
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) : arena_(&arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.GetArena())
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(arena_->Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T*, size_t)
+    {
+    }
+
+    Arena* GetArena() const
+    {
+        return arena_;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return arena_ == other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return arena_ != other.GetArena();
+    }
+
+private:
+    Arena* arena_;
+};
+
+template <typename T, typename... Args>
+T* Arena::Create(Args&&... args)
+{
+    T* object = new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if constexpr(!std::is_trivially_destructible_v<T>)
+    {
+        destructors_.push_back({object, [](void* ptr) {
+            static_cast<T*>(ptr)->~T();
+        }});
+    }
+
+    return object;
+}
+
+} // namespace memory
@@ -0,0 +1,383 @@
+#pragma once
+
+#include "graph.h"
+#include "router.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Та же таблица маршрутов для всех пар вершин, что и у Router, но в плотных матрицах
+// (веса и предыдущие рёбра построчно) и с расчётом в несколько потоков.
+// На шаге через вершину vertex_through строка и столбец vertex_through не меняются,
+// поэтому строки матрицы можно релаксировать параллельно полосами, а результат побитово
+// совпадает с последовательным Router.
+//
+// StoredWeight и StoredEdgeId задают типы ячеек матриц. Компактный вариант (float, uint32_t)
+// занимает 8 байт на пару вершин вместо 16 (и 32 у Router). Точность при этом такая:
+// - вес маршрута в RouteInfo всегда пересчитывается в Weight по исходным рёбрам графа,
+//   то есть совпадает с точной суммой времени найденного маршрута;
+// - сравнение маршрутов идёт в StoredWeight, поэтому найденный маршрут может быть длиннее
+//   оптимального не более чем на относительную величину n * 2^-24 для float
+//   (n - число рёбер в маршруте), что для времени в минутах лежит далеко за шестой значащей цифрой
+template <typename Weight, typename StoredWeight = Weight, typename StoredEdgeId = EdgeId>
+class BlockedRouter
+{
+private:
+    using Graph = DirectedWeightedGraph<Weight>;
+
+public:
+    using RouteInfo = typename Router<Weight>::RouteInfo;
+    using RouteInternalData = typename Router<Weight>::RouteInternalData;
+
+    // Маркеры в матрице предыдущих рёбер: маршрута нет / маршрут из вершины в саму себя
+    static constexpr StoredEdgeId NO_ROUTE = std::numeric_limits<StoredEdgeId>::max();
+    static constexpr StoredEdgeId NO_EDGE = std::numeric_limits<StoredEdgeId>::max() - 1;
+
+    explicit BlockedRouter(const Graph& graph, size_t thread_count = 1);
+    BlockedRouter(const Graph& graph, std::vector<StoredWeight> weights, std::vector<StoredEdgeId> prev_edges);
+    // Матрицы лежат во внешней памяти (например, в отображённом в память файле базы),
+    // storage держит эту память, пока жив роутер
+    BlockedRouter(const Graph& graph, std::shared_ptr<const void> storage, const StoredWeight* weights, const StoredEdgeId* prev_edges);
+
+    std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+    std::optional<RouteInternalData> GetRouteInternalData(VertexId from, VertexId to) const;
+
+    size_t GetVertexCount() const;
+    const StoredWeight* GetWeights() const;
+    const StoredEdgeId* GetPrevEdges() const;
+
+private:
+    // Барьер, разделяющий шаги алгоритма между потоками
+    class Barrier
+    {
+    public:
+        explicit Barrier(size_t thread_count) : thread_count_(thread_count)
+        {
+        }
+
+        void Wait()
+        {
+            std::unique_lock lock(mutex_);
+            const size_t generation = generation_;
+            if(++waiting_count_ == thread_count_)
+            {
+                waiting_count_ = 0;
+                ++generation_;
+                condition_.notify_all();
+                return;
+            }
+            condition_.wait(lock, [this, generation] {
+                return generation_ != generation;
+            });
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        size_t thread_count_;
+        size_t waiting_count_ = 0;
+        size_t generation_ = 0;
+    };
+
+    size_t Index(VertexId from, VertexId to) const
+    {
+        return from * vertex_count_ + to;
+    }
+
+    void InitializeRoutesInternalData(const Graph& graph)
+    {
+        if(graph.GetEdgeCount() >= NO_EDGE)
+        {
+            throw std::length_error("Too many edges for the routes internal data");
+        }
+
+        weights_.assign(vertex_count_ * vertex_count_, StoredWeight{});
+        prev_edges_.assign(vertex_count_ * vertex_count_, NO_ROUTE);
+
+        for(VertexId vertex = 0; vertex < vertex_count_; ++vertex)
+        {
+            prev_edges_[Index(vertex, vertex)] = NO_EDGE;
+            for(const auto& edge : graph.GetAdjacentEdges(vertex))
+            {
+                if(edge.weight < ZERO_WEIGHT)
+                {
+                    throw std::domain_error("Edges' weights should be non-negative");
+                }
+
+                const size_t index = Index(vertex, edge.to);
+                const StoredWeight weight = static_cast<StoredWeight>(edge.weight);
+                if(prev_edges_[index] == NO_ROUTE || weights_[index] > weight)
+                {
+                    weights_[index] = weight;
+                    prev_edges_[index] = static_cast<StoredEdgeId>(edge.id);
+                }
+            }
+        }
+    }
+
+    // Правило обновления совпадает с Router::RelaxRoute
+    void RelaxRowsThroughVertex(VertexId row_begin, VertexId row_end, VertexId vertex_through)
+    {
+        const StoredWeight* weights_through = weights_.data() + Index(vertex_through, 0);
+        const StoredEdgeId* prev_edges_through = prev_edges_.data() + Index(vertex_through, 0);
+
+        for(VertexId vertex_from = row_begin; vertex_from < row_end; ++vertex_from)
+        {
+            const size_t index_from = Index(vertex_from, vertex_through);
+            const StoredEdgeId prev_edge_from = prev_edges_[index_from];
+            if(prev_edge_from == NO_ROUTE)
+            {
+                continue;
+            }
+            const StoredWeight weight_from = weights_[index_from];
+
+            StoredWeight* weights_row = weights_.data() + Index(vertex_from, 0);
+            StoredEdgeId* prev_edges_row = prev_edges_.data() + Index(vertex_from, 0);
+            for(VertexId vertex_to = 0; vertex_to < vertex_count_; ++vertex_to)
+            {
+                const StoredEdgeId prev_edge_to = prev_edges_through[vertex_to];
+                if(prev_edge_to == NO_ROUTE)
+                {
+                    continue;
+                }
+
+                const StoredWeight candidate_weight = weight_from + weights_through[vertex_to];
+                if(prev_edges_row[vertex_to] == NO_ROUTE || candidate_weight < weights_row[vertex_to])
+                {
+                    weights_row[vertex_to] = candidate_weight;
+                    prev_edges_row[vertex_to] = prev_edge_to != NO_EDGE ? prev_edge_to : prev_edge_from;
+                }
+            }
+        }
+    }
+
+    void RelaxRoutesInternalData(size_t thread_count)
+    {
+        thread_count = std::max<size_t>(1, std::min(thread_count, vertex_count_));
+        if(thread_count == 1)
+        {
+            for(VertexId vertex_through = 0; vertex_through < vertex_count_; ++vertex_through)
+            {
+                RelaxRowsThroughVertex(0, vertex_count_, vertex_through);
+            }
+            return;
+        }
+
+        // Каждый поток отвечает за свою полосу строк, после каждого шага - барьер
+        Barrier barrier(thread_count);
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for(size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+        {
+            const VertexId row_begin = vertex_count_ * thread_id / thread_count;
+            const VertexId row_end = vertex_count_ * (thread_id + 1) / thread_count;
+            threads.emplace_back([this, &barrier, row_begin, row_end] {
+                for(VertexId vertex_through = 0; vertex_through < vertex_count_; ++vertex_through)
+                {
+                    RelaxRowsThroughVertex(row_begin, row_end, vertex_through);
+                    barrier.Wait();
+                }
+            });
+        }
+
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Та же проверка загруженной таблицы, что и в Router: предыдущие рёбра каждой строки
+    // образуют дерево путей из начальной вершины
+    void CheckRoutesInternalData() const
+    {
+        if(graph_.GetEdgeCount() >= NO_EDGE)
+        {
+            throw std::length_error("Too many edges for the routes internal data");
+        }
+
+        // Вершины, путь до которых уже проверен в строке reached_from[vertex]
+        std::vector<VertexId> reached_from(vertex_count_, vertex_count_);
+        std::vector<VertexId> path;
+        for(VertexId vertex_from = 0; vertex_from < vertex_count_; ++vertex_from)
+        {
+            const StoredEdgeId* prev_edges_row = prev_edges_data_ + Index(vertex_from, 0);
+            if(prev_edges_row[vertex_from] != NO_EDGE)
+            {
+                throw std::invalid_argument("Broken routes internal data");
+            }
+            reached_from[vertex_from] = vertex_from;
+
+            for(VertexId vertex_to = 0; vertex_to < vertex_count_; ++vertex_to)
+            {
+                if(prev_edges_row[vertex_to] == NO_ROUTE)
+                {
+                    continue;
+                }
+
+                path.clear();
+                for(VertexId vertex = vertex_to; reached_from[vertex] != vertex_from;)
+                {
+                    const StoredEdgeId prev_edge = prev_edges_row[vertex];
+                    if(prev_edge >= graph_.GetEdgeCount() || graph_.GetEdge(prev_edge).to != vertex || path.size() == vertex_count_)
+                    {
+                        throw std::invalid_argument("Broken routes internal data");
+                    }
+
+                    path.push_back(vertex);
+                    vertex = graph_.GetEdge(prev_edge).from;
+                }
+
+                for(const VertexId vertex : path)
+                {
+                    reached_from[vertex] = vertex_from;
+                }
+            }
+        }
+    }
+
+    static constexpr Weight ZERO_WEIGHT{};
+    const Graph& graph_;
+    size_t vertex_count_ = 0;
+    std::vector<StoredWeight> weights_;
+    std::vector<StoredEdgeId> prev_edges_;
+
+    // Откуда читаются матрицы при поиске маршрутов: собственные векторы или внешняя память
+    std::shared_ptr<const void> storage_;
+    const StoredWeight* weights_data_ = nullptr;
+    const StoredEdgeId* prev_edges_data_ = nullptr;
+};
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+BlockedRouter<Weight, StoredWeight, StoredEdgeId>::BlockedRouter(const Graph& graph, size_t thread_count) : graph_(graph), vertex_count_(graph.GetVertexCount())
+{
+    InitializeRoutesInternalData(graph);
+    RelaxRoutesInternalData(thread_count);
+
+    weights_data_ = weights_.data();
+    prev_edges_data_ = prev_edges_.data();
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+BlockedRouter<Weight, StoredWeight, StoredEdgeId>::BlockedRouter(const Graph& graph, std::vector<StoredWeight> weights, std::vector<StoredEdgeId> prev_edges)
+    : graph_(graph),
+      vertex_count_(graph.GetVertexCount()),
+      weights_(std::move(weights)),
+      prev_edges_(std::move(prev_edges))
+{
+    if(weights_.size() != vertex_count_ * vertex_count_ || prev_edges_.size() != weights_.size())
+    {
+        throw std::invalid_argument("Routes internal data doesn't match the graph");
+    }
+
+    weights_data_ = weights_.data();
+    prev_edges_data_ = prev_edges_.data();
+    CheckRoutesInternalData();
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+BlockedRouter<Weight, StoredWeight, StoredEdgeId>::BlockedRouter(const Graph& graph,
+                                                                 std::shared_ptr<const void> storage,
+                                                                 const StoredWeight* weights,
+                                                                 const StoredEdgeId* prev_edges)
+    : graph_(graph),
+      vertex_count_(graph.GetVertexCount()),
+      storage_(std::move(storage)),
+      weights_data_(weights),
+      prev_edges_data_(prev_edges)
+{
+    CheckRoutesInternalData();
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+std::optional<typename BlockedRouter<Weight, StoredWeight, StoredEdgeId>::RouteInfo>
+BlockedRouter<Weight, StoredWeight, StoredEdgeId>::BuildRoute(VertexId from, VertexId to) const
+{
+    if(from >= vertex_count_ || to >= vertex_count_)
+    {
+        throw std::out_of_range("Vertex id is out of range");
+    }
+
+    const size_t index = Index(from, to);
+    if(prev_edges_data_[index] == NO_ROUTE)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<EdgeId> edges;
+    for(StoredEdgeId edge_id = prev_edges_data_[index]; edge_id != NO_EDGE; edge_id = prev_edges_data_[Index(from, graph_.GetEdge(edge_id).from)])
+    {
+        edges.push_back(edge_id);
+    }
+    std::reverse(edges.begin(), edges.end());
+
+    if constexpr(std::is_same_v<StoredWeight, Weight>)
+    {
+        return RouteInfo{weights_data_[index], std::move(edges)};
+    }
+    else
+    {
+        Weight weight = ZERO_WEIGHT;
+        for(const EdgeId edge_id : edges)
+        {
+            weight += graph_.GetEdge(edge_id).weight;
+        }
+
+        return RouteInfo{weight, std::move(edges)};
+    }
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+std::optional<typename BlockedRouter<Weight, StoredWeight, StoredEdgeId>::RouteInternalData>
+BlockedRouter<Weight, StoredWeight, StoredEdgeId>::GetRouteInternalData(VertexId from, VertexId to) const
+{
+    if(from >= vertex_count_ || to >= vertex_count_)
+    {
+        throw std::out_of_range("Vertex id is out of range");
+    }
+
+    const size_t index = Index(from, to);
+    if(prev_edges_data_[index] == NO_ROUTE)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<EdgeId> prev_edge;
+    if(prev_edges_data_[index] != NO_EDGE)
+    {
+        prev_edge = prev_edges_data_[index];
+    }
+
+    return RouteInternalData{static_cast<Weight>(weights_data_[index]), prev_edge};
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+size_t BlockedRouter<Weight, StoredWeight, StoredEdgeId>::GetVertexCount() const
+{
+    return vertex_count_;
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+const StoredWeight* BlockedRouter<Weight, StoredWeight, StoredEdgeId>::GetWeights() const
+{
+    return weights_data_;
+}
+
+template <typename Weight, typename StoredWeight, typename StoredEdgeId>
+const StoredEdgeId* BlockedRouter<Weight, StoredWeight, StoredEdgeId>::GetPrevEdges() const
+{
+    return prev_edges_data_;
+}
+
+}  // namespace graph
@@ -0,0 +1,700 @@
+#pragma once
+
+#include "graph.h"
+#include "router.h"
+#include "workspace_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Иерархия сокращений (contraction hierarchies): вершины упорядочиваются по важности,
+// при "стягивании" очередной вершины добавляются рёбра-сокращения, сохраняющие кратчайшие пути.
+// Запрос - двунаправленный Дейкстра только по рёбрам, ведущим вверх по иерархии.
+// Рабочие буферы переиспользуются между запросами через пул, поэтому BuildRoute можно вызывать из нескольких потоков
+template <typename Weight>
+class ContractionHierarchy
+{
+private:
+    using Graph = DirectedWeightedGraph<Weight>;
+
+public:
+    using RouteInfo = typename Router<Weight>::RouteInfo;
+    using Terminal = RouteTerminal<Weight>;
+
+    // Сокращение заменяет путь first_edge -> second_edge. Рёбра иерархии с id < graph.GetEdgeCount()
+    // совпадают с рёбрами исходного графа, остальные - сокращения в порядке добавления
+    struct Shortcut
+    {
+        VertexId from;
+        VertexId to;
+        Weight weight;
+        EdgeId first_edge;
+        EdgeId second_edge;
+    };
+
+    explicit ContractionHierarchy(const Graph& graph);
+    ContractionHierarchy(const Graph& graph, std::vector<size_t> ranks, std::vector<Shortcut> shortcuts);
+
+    std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+    // Прямой поиск стартует сразу от всех начал, обратный - от всех концов
+    std::optional<TerminalRouteInfo<Weight>> BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const;
+
+    const std::vector<size_t>& GetRanks() const;
+    const std::vector<Shortcut>& GetShortcuts() const;
+
+private:
+    struct QueueItem
+    {
+        Weight weight;
+        VertexId vertex;
+
+        bool operator>(const QueueItem& other) const
+        {
+            return weight > other.weight;
+        }
+    };
+
+    struct SearchSpace
+    {
+        explicit SearchSpace(size_t vertex_count) : weights(vertex_count),
+                                                    prev_edges(vertex_count),
+                                                    is_settled(vertex_count),
+                                                    search_ids(vertex_count, 0)
+        {
+        }
+
+        bool IsReached(VertexId vertex, uint32_t search_id) const
+        {
+            return search_ids[vertex] == search_id;
+        }
+
+        void Reach(VertexId vertex, Weight weight, std::optional<EdgeId> prev_edge, uint32_t search_id)
+        {
+            search_ids[vertex] = search_id;
+            weights[vertex] = weight;
+            prev_edges[vertex] = prev_edge;
+            is_settled[vertex] = false;
+
+            queue.push_back({weight, vertex});
+            std::push_heap(queue.begin(), queue.end(), std::greater<QueueItem>{});
+        }
+
+        QueueItem Pop()
+        {
+            std::pop_heap(queue.begin(), queue.end(), std::greater<QueueItem>{});
+            const QueueItem item = queue.back();
+            queue.pop_back();
+            return item;
+        }
+
+        std::vector<Weight> weights;
+        std::vector<std::optional<EdgeId>> prev_edges;
+        std::vector<bool> is_settled;
+        std::vector<uint32_t> search_ids;
+        std::vector<QueueItem> queue;
+    };
+
+    // Рабочие буферы одного двунаправленного поиска
+    struct Workspace
+    {
+        explicit Workspace(size_t vertex_count) : forward(vertex_count), backward(vertex_count)
+        {
+        }
+
+        void StartSearch()
+        {
+            ++search_id;
+            if(search_id == 0)
+            {
+                std::fill(forward.search_ids.begin(), forward.search_ids.end(), 0);
+                std::fill(backward.search_ids.begin(), backward.search_ids.end(), 0);
+                search_id = 1;
+            }
+            forward.queue.clear();
+            backward.queue.clear();
+        }
+
+        SearchSpace forward;
+        SearchSpace backward;
+        uint32_t search_id = 0;
+    };
+
+    // Ребро в процессе построения иерархии, хранимое у одного из концов
+    struct Arc
+    {
+        VertexId vertex;
+        Weight weight;
+        EdgeId edge_id;
+    };
+
+    // Состояние, нужное только на время построения иерархии
+    struct ContractionState
+    {
+        explicit ContractionState(size_t vertex_count) : out_arcs(vertex_count),
+                                                         in_arcs(vertex_count),
+                                                         contracted_neighbours(vertex_count, 0),
+                                                         neighbour_slots(vertex_count, NO_SLOT),
+                                                         witness(vertex_count)
+        {
+        }
+
+        std::vector<std::vector<Arc>> out_arcs;
+        std::vector<std::vector<Arc>> in_arcs;
+        std::vector<size_t> contracted_neighbours;
+        std::vector<size_t> neighbour_slots;
+        SearchSpace witness;
+        uint32_t witness_search_id = 0;
+    };
+
+    Edge<Weight> GetHierarchyEdge(EdgeId edge_id) const
+    {
+        if(edge_id < graph_.GetEdgeCount())
+        {
+            return graph_.GetEdge(edge_id);
+        }
+
+        const Shortcut& shortcut = shortcuts_[edge_id - graph_.GetEdgeCount()];
+        return {shortcut.from, shortcut.to, shortcut.weight};
+    }
+
+    void AddHierarchyEdge(ContractionState& state, EdgeId edge_id) const
+    {
+        const Edge<Weight> edge = GetHierarchyEdge(edge_id);
+        if(edge.from == edge.to)
+        {
+            return;
+        }
+
+        state.out_arcs[edge.from].push_back({edge.to, edge.weight, edge_id});
+        state.in_arcs[edge.to].push_back({edge.from, edge.weight, edge_id});
+    }
+
+    static void RemoveArcsTo(std::vector<Arc>& arcs, VertexId vertex)
+    {
+        arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [vertex](const Arc& arc) {
+            return arc.vertex == vertex;
+        }), arcs.end());
+    }
+
+    // Для каждой соседней вершины оставляет самое лёгкое ребро
+    std::vector<Arc> CollectNeighbours(ContractionState& state, VertexId vertex, bool is_outgoing) const
+    {
+        std::vector<Arc> neighbours;
+        for(const Arc& arc : is_outgoing ? state.out_arcs[vertex] : state.in_arcs[vertex])
+        {
+            size_t& slot = state.neighbour_slots[arc.vertex];
+            if(slot == NO_SLOT)
+            {
+                slot = neighbours.size();
+                neighbours.push_back(arc);
+            }
+            else if(arc.weight < neighbours[slot].weight)
+            {
+                neighbours[slot] = arc;
+            }
+        }
+
+        for(const Arc& neighbour : neighbours)
+        {
+            state.neighbour_slots[neighbour.vertex] = NO_SLOT;
+        }
+
+        return neighbours;
+    }
+
+    // Ограниченный поиск Дейкстры в обход стягиваемой вершины
+    void RunWitnessSearch(ContractionState& state, VertexId source, VertexId excluded, Weight max_weight) const
+    {
+        SearchSpace& witness = state.witness;
+        ++state.witness_search_id;
+        if(state.witness_search_id == 0)
+        {
+            std::fill(witness.search_ids.begin(), witness.search_ids.end(), 0);
+            state.witness_search_id = 1;
+        }
+        witness.queue.clear();
+        witness.Reach(source, ZERO_WEIGHT, std::nullopt, state.witness_search_id);
+
+        size_t settled_count = 0;
+        while(!witness.queue.empty() && settled_count < WITNESS_SETTLED_LIMIT)
+        {
+            const QueueItem item = witness.Pop();
+            if(witness.is_settled[item.vertex] || witness.weights[item.vertex] < item.weight)
+            {
+                continue;
+            }
+            if(max_weight < item.weight)
+            {
+                break;
+            }
+            witness.is_settled[item.vertex] = true;
+            ++settled_count;
+
+            for(const Arc& arc : state.out_arcs[item.vertex])
+            {
+                if(arc.vertex == excluded)
+                {
+                    continue;
+                }
+
+                const Weight candidate_weight = item.weight + arc.weight;
+                if(!witness.IsReached(arc.vertex, state.witness_search_id) || candidate_weight < witness.weights[arc.vertex])
+                {
+                    witness.Reach(arc.vertex, candidate_weight, std::nullopt, state.witness_search_id);
+                }
+            }
+        }
+    }
+
+    std::vector<Shortcut> FindShortcuts(ContractionState& state, VertexId vertex, const std::vector<Arc>& in_neighbours, const std::vector<Arc>& out_neighbours) const
+    {
+        std::vector<Shortcut> shortcuts;
+        for(const Arc& in_arc : in_neighbours)
+        {
+            std::optional<Weight> max_weight;
+            for(const Arc& out_arc : out_neighbours)
+            {
+                const Weight weight = in_arc.weight + out_arc.weight;
+                if(out_arc.vertex != in_arc.vertex && (!max_weight || *max_weight < weight))
+                {
+                    max_weight = weight;
+                }
+            }
+            if(!max_weight)
+            {
+                continue;
+            }
+
+            RunWitnessSearch(state, in_arc.vertex, vertex, *max_weight);
+
+            for(const Arc& out_arc : out_neighbours)
+            {
+                if(out_arc.vertex == in_arc.vertex)
+                {
+                    continue;
+                }
+
+                const Weight weight = in_arc.weight + out_arc.weight;
+                const bool has_witness = state.witness.IsReached(out_arc.vertex, state.witness_search_id)
+                                      && !(weight < state.witness.weights[out_arc.vertex]);
+                if(!has_witness)
+                {
+                    shortcuts.push_back({in_arc.vertex, out_arc.vertex, weight, in_arc.edge_id, out_arc.edge_id});
+                }
+            }
+        }
+
+        return shortcuts;
+    }
+
+    int64_t ComputePriority(ContractionState& state, VertexId vertex) const
+    {
+        const auto in_neighbours = CollectNeighbours(state, vertex, false);
+        const auto out_neighbours = CollectNeighbours(state, vertex, true);
+        const int64_t shortcut_count = FindShortcuts(state, vertex, in_neighbours, out_neighbours).size();
+
+        return shortcut_count - static_cast<int64_t>(in_neighbours.size() + out_neighbours.size())
+             + static_cast<int64_t>(state.contracted_neighbours[vertex]);
+    }
+
+    void Contract()
+    {
+        const size_t vertex_count = graph_.GetVertexCount();
+        ContractionState state(vertex_count);
+
+        for(EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+        {
+            if(graph_.GetEdge(edge_id).weight < ZERO_WEIGHT)
+            {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+            AddHierarchyEdge(state, edge_id);
+        }
+
+        using PriorityItem = std::pair<int64_t, VertexId>;
+        std::vector<PriorityItem> queue;
+        for(VertexId vertex = 0; vertex < vertex_count; ++vertex)
+        {
+            queue.emplace_back(ComputePriority(state, vertex), vertex);
+        }
+        std::make_heap(queue.begin(), queue.end(), std::greater<PriorityItem>{});
+
+        ranks_.assign(vertex_count, 0);
+        size_t rank = 0;
+        while(!queue.empty())
+        {
+            std::pop_heap(queue.begin(), queue.end(), std::greater<PriorityItem>{});
+            const VertexId vertex = queue.back().second;
+            queue.pop_back();
+
+            // Приоритеты обновляются лениво: если вершина подешевела не так сильно, как казалось, откладываем её
+            const int64_t priority = ComputePriority(state, vertex);
+            if(!queue.empty() && queue.front().first < priority)
+            {
+                queue.emplace_back(priority, vertex);
+                std::push_heap(queue.begin(), queue.end(), std::greater<PriorityItem>{});
+                continue;
+            }
+
+            const auto in_neighbours = CollectNeighbours(state, vertex, false);
+            const auto out_neighbours = CollectNeighbours(state, vertex, true);
+            for(Shortcut& shortcut : FindShortcuts(state, vertex, in_neighbours, out_neighbours))
+            {
+                shortcuts_.push_back(std::move(shortcut));
+                AddHierarchyEdge(state, graph_.GetEdgeCount() + shortcuts_.size() - 1);
+            }
+
+            // Стянутая вершина исчезает из оставшегося графа
+            ranks_[vertex] = rank++;
+
+            for(const Arc& neighbour : in_neighbours)
+            {
+                RemoveArcsTo(state.out_arcs[neighbour.vertex], vertex);
+                ++state.contracted_neighbours[neighbour.vertex];
+            }
+            for(const Arc& neighbour : out_neighbours)
+            {
+                RemoveArcsTo(state.in_arcs[neighbour.vertex], vertex);
+                ++state.contracted_neighbours[neighbour.vertex];
+            }
+            state.out_arcs[vertex].clear();
+            state.in_arcs[vertex].clear();
+        }
+    }
+
+    // Иерархия, загруженная из базы, проверяется до первого запроса: ранги - перестановка вершин,
+    // концы сокращений в пределах графа, а сокращение с номером k ссылается только на рёбра с меньшими id,
+    // поэтому распаковка конечна
+    void CheckHierarchy() const
+    {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if(ranks_.size() != vertex_count)
+        {
+            throw std::invalid_argument("Contraction hierarchy doesn't match the graph");
+        }
+
+        std::vector<bool> is_rank_used(vertex_count, false);
+        for(const size_t rank : ranks_)
+        {
+            if(rank >= vertex_count || is_rank_used[rank])
+            {
+                throw std::invalid_argument("Broken contraction hierarchy ranks");
+            }
+            is_rank_used[rank] = true;
+        }
+
+        for(size_t i = 0; i < shortcuts_.size(); ++i)
+        {
+            const Shortcut& shortcut = shortcuts_[i];
+            const EdgeId edge_id = graph_.GetEdgeCount() + i;
+            if(shortcut.from >= vertex_count || shortcut.to >= vertex_count
+               || shortcut.first_edge >= edge_id || shortcut.second_edge >= edge_id)
+            {
+                throw std::invalid_argument("Broken contraction hierarchy shortcut");
+            }
+
+            const Edge<Weight> first_edge = GetHierarchyEdge(shortcut.first_edge);
+            const Edge<Weight> second_edge = GetHierarchyEdge(shortcut.second_edge);
+            if(first_edge.from != shortcut.from || first_edge.to != second_edge.from || second_edge.to != shortcut.to)
+            {
+                throw std::invalid_argument("Broken contraction hierarchy shortcut");
+            }
+        }
+    }
+
+    // Оставляет только рёбра, ведущие вверх по иерархии: исходящие для прямого поиска
+    // и входящие для обратного. Оба набора хранятся в CSR, как и замороженный граф
+    void BuildSearchGraph()
+    {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if(ranks_.size() != vertex_count)
+        {
+            throw std::invalid_argument("Contraction hierarchy doesn't match the graph");
+        }
+
+        const size_t edge_count = graph_.GetEdgeCount() + shortcuts_.size();
+        upward_offsets_.assign(vertex_count + 1, 0);
+        downward_offsets_.assign(vertex_count + 1, 0);
+        for(EdgeId edge_id = 0; edge_id < edge_count; ++edge_id)
+        {
+            const Edge<Weight> edge = GetHierarchyEdge(edge_id);
+            if(ranks_[edge.from] < ranks_[edge.to])
+            {
+                ++upward_offsets_[edge.from + 1];
+            }
+            else if(ranks_[edge.to] < ranks_[edge.from])
+            {
+                ++downward_offsets_[edge.to + 1];
+            }
+        }
+        for(VertexId vertex = 0; vertex < vertex_count; ++vertex)
+        {
+            upward_offsets_[vertex + 1] += upward_offsets_[vertex];
+            downward_offsets_[vertex + 1] += downward_offsets_[vertex];
+        }
+
+        std::vector<size_t> upward_positions(upward_offsets_.begin(), upward_offsets_.end() - 1);
+        std::vector<size_t> downward_positions(downward_offsets_.begin(), downward_offsets_.end() - 1);
+        upward_arcs_.resize(upward_offsets_.back());
+        downward_arcs_.resize(downward_offsets_.back());
+        for(EdgeId edge_id = 0; edge_id < edge_count; ++edge_id)
+        {
+            const Edge<Weight> edge = GetHierarchyEdge(edge_id);
+            if(ranks_[edge.from] < ranks_[edge.to])
+            {
+                upward_arcs_[upward_positions[edge.from]++] = {edge.to, edge.weight, edge_id};
+            }
+            else if(ranks_[edge.to] < ranks_[edge.from])
+            {
+                downward_arcs_[downward_positions[edge.to]++] = {edge.from, edge.weight, edge_id};
+            }
+        }
+    }
+
+    void CheckTerminals(const std::vector<Terminal>& terminals) const
+    {
+        for(const auto& terminal : terminals)
+        {
+            if(terminal.vertex >= graph_.GetVertexCount())
+            {
+                throw std::out_of_range("Vertex id is out of range");
+            }
+        }
+    }
+
+    // Двунаправленный поиск, возвращает вершину встречи
+    std::optional<VertexId> RunSearch(Workspace& workspace, const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const;
+    // Рёбра исходного графа на пути через вершину встречи
+    std::vector<EdgeId> UnpackRoute(const Workspace& workspace, VertexId meeting_vertex) const;
+
+    bool HasQueueItemsBelow(const SearchSpace& search_space, const std::optional<Weight>& best_weight) const
+    {
+        return !search_space.queue.empty() && (!best_weight || search_space.queue.front().weight < *best_weight);
+    }
+
+    void UnpackEdge(EdgeId edge_id, std::vector<EdgeId>& edges) const
+    {
+        std::vector<EdgeId> stack{edge_id};
+        while(!stack.empty())
+        {
+            const EdgeId current = stack.back();
+            stack.pop_back();
+
+            if(current < graph_.GetEdgeCount())
+            {
+                edges.push_back(current);
+            }
+            else
+            {
+                const Shortcut& shortcut = shortcuts_[current - graph_.GetEdgeCount()];
+                stack.push_back(shortcut.second_edge);
+                stack.push_back(shortcut.first_edge);
+            }
+        }
+    }
+
+    static constexpr Weight ZERO_WEIGHT{};
+    static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+    static constexpr size_t WITNESS_SETTLED_LIMIT = 100;
+
+    const Graph& graph_;
+    std::vector<size_t> ranks_;
+    std::vector<Shortcut> shortcuts_;
+    std::vector<size_t> upward_offsets_;
+    std::vector<Arc> upward_arcs_;
+    std::vector<size_t> downward_offsets_;
+    std::vector<Arc> downward_arcs_;
+
+    mutable WorkspacePool<Workspace> workspaces_;
+};
+
+template <typename Weight>
+ContractionHierarchy<Weight>::ContractionHierarchy(const Graph& graph) : graph_(graph),
+                                                                         workspaces_(graph.GetVertexCount())
+{
+    Contract();
+    BuildSearchGraph();
+}
+
+template <typename Weight>
+ContractionHierarchy<Weight>::ContractionHierarchy(const Graph& graph, std::vector<size_t> ranks, std::vector<Shortcut> shortcuts)
+    : graph_(graph),
+      ranks_(std::move(ranks)),
+      shortcuts_(std::move(shortcuts)),
+      workspaces_(graph.GetVertexCount())
+{
+    CheckHierarchy();
+    BuildSearchGraph();
+}
+
+template <typename Weight>
+std::optional<typename ContractionHierarchy<Weight>::RouteInfo> ContractionHierarchy<Weight>::BuildRoute(VertexId from, VertexId to) const
+{
+    if(from >= graph_.GetVertexCount() || to >= graph_.GetVertexCount())
+    {
+        throw std::out_of_range("Vertex id is out of range");
+    }
+
+    const auto lease = workspaces_.Acquire();
+    Workspace& workspace = *lease;
+
+    const std::optional<VertexId> meeting_vertex = RunSearch(workspace, {{from, ZERO_WEIGHT}}, {{to, ZERO_WEIGHT}});
+    if(!meeting_vertex)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<EdgeId> edges = UnpackRoute(workspace, *meeting_vertex);
+
+    // Вес пересчитываем по исходным рёбрам, чтобы порядок суммирования совпадал с другими роутерами
+    Weight weight = ZERO_WEIGHT;
+    for(const EdgeId edge_id : edges)
+    {
+        weight += graph_.GetEdge(edge_id).weight;
+    }
+
+    return RouteInfo{weight, std::move(edges)};
+}
+
+template <typename Weight>
+std::optional<TerminalRouteInfo<Weight>> ContractionHierarchy<Weight>::BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const
+{
+    CheckTerminals(sources);
+    CheckTerminals(targets);
+
+    const auto lease = workspaces_.Acquire();
+    Workspace& workspace = *lease;
+
+    const std::optional<VertexId> meeting_vertex = RunSearch(workspace, sources, targets);
+    if(!meeting_vertex)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<EdgeId> edges = UnpackRoute(workspace, *meeting_vertex);
+
+    const VertexId from = edges.empty() ? *meeting_vertex : graph_.GetEdge(edges.front()).from;
+    const VertexId to = edges.empty() ? *meeting_vertex : graph_.GetEdge(edges.back()).to;
+    const size_t source = FindTerminal(sources, from);
+    const size_t target = FindTerminal(targets, to);
+
+    Weight weight = sources[source].weight;
+    for(const EdgeId edge_id : edges)
+    {
+        weight += graph_.GetEdge(edge_id).weight;
+    }
+    weight += targets[target].weight;
+
+    return TerminalRouteInfo<Weight>{source, target, weight, std::move(edges)};
+}
+
+template <typename Weight>
+std::optional<VertexId> ContractionHierarchy<Weight>::RunSearch(Workspace& workspace, const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const
+{
+    workspace.StartSearch();
+    SearchSpace& forward = workspace.forward;
+    SearchSpace& backward = workspace.backward;
+    const uint32_t search_id = workspace.search_id;
+
+    for(const auto& source : sources)
+    {
+        if(!forward.IsReached(source.vertex, search_id) || source.weight < forward.weights[source.vertex])
+        {
+            forward.Reach(source.vertex, source.weight, std::nullopt, search_id);
+        }
+    }
+    for(const auto& target : targets)
+    {
+        if(!backward.IsReached(target.vertex, search_id) || target.weight < backward.weights[target.vertex])
+        {
+            backward.Reach(target.vertex, target.weight, std::nullopt, search_id);
+        }
+    }
+
+    std::optional<Weight> best_weight;
+    std::optional<VertexId> meeting_vertex;
+
+    while(HasQueueItemsBelow(forward, best_weight) || HasQueueItemsBelow(backward, best_weight))
+    {
+        const bool is_forward = !HasQueueItemsBelow(backward, best_weight)
+                             || (HasQueueItemsBelow(forward, best_weight) && !(backward.queue.front().weight < forward.queue.front().weight));
+        SearchSpace& search_space = is_forward ? forward : backward;
+        const SearchSpace& opposite_space = is_forward ? backward : forward;
+
+        const QueueItem item = search_space.Pop();
+        if(search_space.is_settled[item.vertex] || search_space.weights[item.vertex] < item.weight)
+        {
+            continue;
+        }
+        search_space.is_settled[item.vertex] = true;
+
+        if(opposite_space.IsReached(item.vertex, search_id))
+        {
+            const Weight weight = item.weight + opposite_space.weights[item.vertex];
+            if(!best_weight || weight < *best_weight)
+            {
+                best_weight = weight;
+                meeting_vertex = item.vertex;
+            }
+        }
+
+        const std::vector<Arc>& arcs = is_forward ? upward_arcs_ : downward_arcs_;
+        const std::vector<size_t>& offsets = is_forward ? upward_offsets_ : downward_offsets_;
+        for(size_t i = offsets[item.vertex]; i < offsets[item.vertex + 1]; ++i)
+        {
+            const Arc& arc = arcs[i];
+            const Weight candidate_weight = item.weight + arc.weight;
+            if(!search_space.IsReached(arc.vertex, search_id) || candidate_weight < search_space.weights[arc.vertex])
+            {
+                search_space.Reach(arc.vertex, candidate_weight, arc.edge_id, search_id);
+            }
+        }
+    }
+
+    return meeting_vertex;
+}
+
+template <typename Weight>
+std::vector<EdgeId> ContractionHierarchy<Weight>::UnpackRoute(const Workspace& workspace, VertexId meeting_vertex) const
+{
+    std::vector<EdgeId> hierarchy_edges;
+    for(std::optional<EdgeId> edge_id = workspace.forward.prev_edges[meeting_vertex]; edge_id; edge_id = workspace.forward.prev_edges[GetHierarchyEdge(*edge_id).from])
+    {
+        hierarchy_edges.push_back(*edge_id);
+    }
+    std::reverse(hierarchy_edges.begin(), hierarchy_edges.end());
+    for(std::optional<EdgeId> edge_id = workspace.backward.prev_edges[meeting_vertex]; edge_id; edge_id = workspace.backward.prev_edges[GetHierarchyEdge(*edge_id).to])
+    {
+        hierarchy_edges.push_back(*edge_id);
+    }
+
+    std::vector<EdgeId> edges;
+    for(const EdgeId edge_id : hierarchy_edges)
+    {
+        UnpackEdge(edge_id, edges);
+    }
+
+    return edges;
+}
+
+template <typename Weight>
+const std::vector<size_t>& ContractionHierarchy<Weight>::GetRanks() const
+{
+    return ranks_;
+}
+
+template <typename Weight>
+const std::vector<typename ContractionHierarchy<Weight>::Shortcut>& ContractionHierarchy<Weight>::GetShortcuts() const
+{
+    return shortcuts_;
+}
+
+}  // namespace graph
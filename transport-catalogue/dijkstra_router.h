@@ -0,0 +1,259 @@
+#pragma once
+
+#include "graph.h"
+#include "router.h"
+#include "workspace_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Ищет кратчайший путь алгоритмом Дейкстры по запросу, не храня таблицу маршрутов для всех пар вершин.
+// Рабочие буферы переиспользуются между запросами через пул, поэтому BuildRoute можно вызывать из нескольких потоков
+template <typename Weight>
+class DijkstraRouter
+{
+private:
+    using Graph = DirectedWeightedGraph<Weight>;
+
+public:
+    using RouteInfo = typename Router<Weight>::RouteInfo;
+    using Terminal = RouteTerminal<Weight>;
+
+    explicit DijkstraRouter(const Graph& graph);
+
+    std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+    // Один проход сразу от всех начал, пока не найден лучший из концов
+    std::optional<TerminalRouteInfo<Weight>> BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const;
+
+private:
+    struct QueueItem
+    {
+        Weight weight;
+        VertexId vertex;
+
+        bool operator>(const QueueItem& other) const
+        {
+            return weight > other.weight;
+        }
+    };
+
+    // Рабочие буферы одного поиска
+    struct Workspace
+    {
+        explicit Workspace(size_t vertex_count) : weights(vertex_count),
+                                                  prev_edges(vertex_count),
+                                                  is_settled(vertex_count),
+                                                  search_ids(vertex_count, 0)
+        {
+        }
+
+        void StartSearch()
+        {
+            ++search_id;
+            if(search_id == 0)
+            {
+                std::fill(search_ids.begin(), search_ids.end(), 0);
+                search_id = 1;
+            }
+            queue.clear();
+        }
+
+        bool IsReached(VertexId vertex) const
+        {
+            return search_ids[vertex] == search_id;
+        }
+
+        void Reach(VertexId vertex, Weight weight, std::optional<EdgeId> prev_edge)
+        {
+            search_ids[vertex] = search_id;
+            weights[vertex] = weight;
+            prev_edges[vertex] = prev_edge;
+            is_settled[vertex] = false;
+
+            queue.push_back({weight, vertex});
+            std::push_heap(queue.begin(), queue.end(), std::greater<QueueItem>{});
+        }
+
+        QueueItem Pop()
+        {
+            std::pop_heap(queue.begin(), queue.end(), std::greater<QueueItem>{});
+            const QueueItem item = queue.back();
+            queue.pop_back();
+            return item;
+        }
+
+        std::vector<Weight> weights;
+        std::vector<std::optional<EdgeId>> prev_edges;
+        std::vector<bool> is_settled;
+        std::vector<uint32_t> search_ids;
+        uint32_t search_id = 0;
+        std::vector<QueueItem> queue;
+    };
+
+    static constexpr Weight ZERO_WEIGHT{};
+    const Graph& graph_;
+
+    mutable WorkspacePool<Workspace> workspaces_;
+};
+
+template <typename Weight>
+DijkstraRouter<Weight>::DijkstraRouter(const Graph& graph) : graph_(graph),
+                                                             workspaces_(graph.GetVertexCount())
+{
+    for(EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id)
+    {
+        if(graph.GetEdge(edge_id).weight < ZERO_WEIGHT)
+        {
+            throw std::domain_error("Edges' weights should be non-negative");
+        }
+    }
+}
+
+template <typename Weight>
+std::optional<typename DijkstraRouter<Weight>::RouteInfo> DijkstraRouter<Weight>::BuildRoute(VertexId from, VertexId to) const
+{
+    if(from >= graph_.GetVertexCount() || to >= graph_.GetVertexCount())
+    {
+        throw std::out_of_range("Vertex id is out of range");
+    }
+
+    const auto lease = workspaces_.Acquire();
+    Workspace& workspace = *lease;
+
+    workspace.StartSearch();
+    workspace.Reach(from, ZERO_WEIGHT, std::nullopt);
+
+    while(!workspace.queue.empty())
+    {
+        const QueueItem item = workspace.Pop();
+
+        if(workspace.is_settled[item.vertex] || workspace.weights[item.vertex] < item.weight)
+        {
+            continue;
+        }
+        workspace.is_settled[item.vertex] = true;
+
+        if(item.vertex == to)
+        {
+            break;
+        }
+
+        for(const auto& edge : graph_.GetAdjacentEdges(item.vertex))
+        {
+            const Weight candidate_weight = item.weight + edge.weight;
+            if(!workspace.IsReached(edge.to) || candidate_weight < workspace.weights[edge.to])
+            {
+                workspace.Reach(edge.to, candidate_weight, edge.id);
+            }
+        }
+    }
+
+    if(!workspace.IsReached(to))
+    {
+        return std::nullopt;
+    }
+
+    std::vector<EdgeId> edges;
+    for(std::optional<EdgeId> edge_id = workspace.prev_edges[to]; edge_id; edge_id = workspace.prev_edges[graph_.GetEdge(*edge_id).from])
+    {
+        edges.push_back(*edge_id);
+    }
+    std::reverse(edges.begin(), edges.end());
+
+    return RouteInfo{workspace.weights[to], std::move(edges)};
+}
+
+template <typename Weight>
+std::optional<TerminalRouteInfo<Weight>> DijkstraRouter<Weight>::BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const
+{
+    for(const auto& terminal : sources)
+    {
+        if(terminal.vertex >= graph_.GetVertexCount())
+        {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+    }
+    for(const auto& terminal : targets)
+    {
+        if(terminal.vertex >= graph_.GetVertexCount())
+        {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+    }
+
+    const auto lease = workspaces_.Acquire();
+    Workspace& workspace = *lease;
+
+    workspace.StartSearch();
+    for(const auto& source : sources)
+    {
+        if(!workspace.IsReached(source.vertex) || source.weight < workspace.weights[source.vertex])
+        {
+            workspace.Reach(source.vertex, source.weight, std::nullopt);
+        }
+    }
+
+    // Добавочные веса концов неотрицательны, поэтому дальше вершин тяжелее лучшего маршрута искать незачем
+    std::optional<Weight> best_weight;
+    size_t best_target = 0;
+
+    while(!workspace.queue.empty())
+    {
+        const QueueItem item = workspace.Pop();
+
+        if(best_weight && !(item.weight < *best_weight))
+        {
+            break;
+        }
+        if(workspace.is_settled[item.vertex] || workspace.weights[item.vertex] < item.weight)
+        {
+            continue;
+        }
+        workspace.is_settled[item.vertex] = true;
+
+        for(size_t i = 0; i < targets.size(); ++i)
+        {
+            const Weight weight = item.weight + targets[i].weight;
+            if(targets[i].vertex == item.vertex && (!best_weight || weight < *best_weight))
+            {
+                best_weight = weight;
+                best_target = i;
+            }
+        }
+
+        for(const auto& edge : graph_.GetAdjacentEdges(item.vertex))
+        {
+            const Weight candidate_weight = item.weight + edge.weight;
+            if(!workspace.IsReached(edge.to) || candidate_weight < workspace.weights[edge.to])
+            {
+                workspace.Reach(edge.to, candidate_weight, edge.id);
+            }
+        }
+    }
+
+    if(!best_weight)
+    {
+        return std::nullopt;
+    }
+
+    const VertexId to = targets[best_target].vertex;
+    std::vector<EdgeId> edges;
+    for(std::optional<EdgeId> edge_id = workspace.prev_edges[to]; edge_id; edge_id = workspace.prev_edges[graph_.GetEdge(*edge_id).from])
+    {
+        edges.push_back(*edge_id);
+    }
+    std::reverse(edges.begin(), edges.end());
+
+    const VertexId from = edges.empty() ? to : graph_.GetEdge(edges.front()).from;
+
+    return TerminalRouteInfo<Weight>{FindTerminal(sources, from), best_target, *best_weight, std::move(edges)};
+}
+
+}  // namespace graph
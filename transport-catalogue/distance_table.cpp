@@ -0,0 +1,135 @@
+#include "distance_table.h"
+
+#include <utility>
+
+namespace transport {
+
+DistanceTable::ConstIterator::ConstIterator(const DistanceTable* table, size_t slot) : table_(table), slot_(slot)
+{
+    SkipNotExplicit();
+}
+
+DistanceTable::Entry DistanceTable::ConstIterator::operator*() const
+{
+    const Slot& slot = table_->slots_[slot_];
+    return {static_cast<domain::StopId>(slot.key >> 32), static_cast<domain::StopId>(slot.key), slot.distance};
+}
+
+DistanceTable::ConstIterator& DistanceTable::ConstIterator::operator++()
+{
+    ++slot_;
+    SkipNotExplicit();
+    return *this;
+}
+
+bool DistanceTable::ConstIterator::operator==(const ConstIterator& other) const
+{
+    return table_ == other.table_ && slot_ == other.slot_;
+}
+
+bool DistanceTable::ConstIterator::operator!=(const ConstIterator& other) const
+{
+    return !(*this == other);
+}
+
+void DistanceTable::ConstIterator::SkipNotExplicit()
+{
+    while(slot_ < table_->slots_.size() && !table_->slots_[slot_].is_explicit)
+    {
+        ++slot_;
+    }
+}
+
+void DistanceTable::Set(domain::StopId from, domain::StopId to, double distance)
+{
+    Insert(MakeKey(from, to), distance, true);
+
+    // Обратное расстояние берётся из прямого, пока его не задали явно
+    const uint64_t reverse_key = MakeKey(to, from);
+    const size_t reverse_slot = FindSlot(reverse_key);
+    if(slots_[reverse_slot].key == EMPTY_KEY || !slots_[reverse_slot].is_explicit)
+    {
+        Insert(reverse_key, distance, false);
+    }
+}
+
+const double* DistanceTable::Find(domain::StopId from, domain::StopId to) const
+{
+    if(slots_.empty())
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = slots_[FindSlot(MakeKey(from, to))];
+    return slot.key != EMPTY_KEY ? &slot.distance : nullptr;
+}
+
+size_t DistanceTable::GetSize() const
+{
+    return explicit_size_;
+}
+
+DistanceTable::ConstIterator DistanceTable::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+DistanceTable::ConstIterator DistanceTable::end() const
+{
+    return ConstIterator(this, slots_.size());
+}
+
+uint64_t DistanceTable::MakeKey(domain::StopId from, domain::StopId to)
+{
+    return (static_cast<uint64_t>(from) << 32) | to;
+}
+
+size_t DistanceTable::FindSlot(uint64_t key) const
+{
+    // Вместимость - степень двойки, хеш Фибоначчи перемешивает номера соседних остановок
+    const size_t mask = slots_.size() - 1;
+    size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while(slots_[slot].key != EMPTY_KEY && slots_[slot].key != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+void DistanceTable::Insert(uint64_t key, double distance, bool is_explicit)
+{
+    // Заполненность не больше половины, чтобы цепочки проб оставались короткими
+    if((size_ + 1) * 2 > slots_.size())
+    {
+        Rehash(slots_.empty() ? MIN_CAPACITY : slots_.size() * 2);
+    }
+
+    Slot& slot = slots_[FindSlot(key)];
+    if(slot.key == EMPTY_KEY)
+    {
+        slot.key = key;
+        ++size_;
+    }
+    if(is_explicit && !slot.is_explicit)
+    {
+        ++explicit_size_;
+    }
+
+    slot.distance = distance;
+    slot.is_explicit = is_explicit;
+}
+
+void DistanceTable::Rehash(size_t capacity)
+{
+    std::vector<Slot> old_slots = std::exchange(slots_, std::vector<Slot>(capacity));
+    for(const Slot& slot : old_slots)
+    {
+        if(slot.key != EMPTY_KEY)
+        {
+            slots_[FindSlot(slot.key)] = slot;
+        }
+    }
+}
+
+} // namespace transport
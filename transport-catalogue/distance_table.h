@@ -0,0 +1,79 @@
+#pragma once
+
+#include "domain.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace transport {
+
+// Хеш-таблица расстояний с открытой адресацией, ключ - пара номеров остановок, упакованная в 64 бита.
+// Расстояние в обратную сторону подставляется сразу при добавлении, если для неё нет своего,
+// поэтому поиск - это одна проба без повторного обращения по перевёрнутому ключу
+class DistanceTable
+{
+public:
+    struct Entry
+    {
+        domain::StopId from;
+        domain::StopId to;
+        double distance;
+    };
+
+    // Обходит только заданные явно расстояния, без подставленных обратных
+    class ConstIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = Entry;
+
+        ConstIterator(const DistanceTable* table, size_t slot);
+
+        Entry operator*() const;
+        ConstIterator& operator++();
+
+        bool operator==(const ConstIterator& other) const;
+        bool operator!=(const ConstIterator& other) const;
+
+    private:
+        void SkipNotExplicit();
+
+        const DistanceTable* table_;
+        size_t slot_;
+    };
+
+    void Set(domain::StopId from, domain::StopId to, double distance);
+    const double* Find(domain::StopId from, domain::StopId to) const;
+
+    size_t GetSize() const;
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+private:
+    static constexpr uint64_t EMPTY_KEY = UINT64_MAX;
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    struct Slot
+    {
+        uint64_t key = EMPTY_KEY;
+        double distance = 0.0;
+        bool is_explicit = false;
+    };
+
+    static uint64_t MakeKey(domain::StopId from, domain::StopId to);
+    size_t FindSlot(uint64_t key) const;
+    void Insert(uint64_t key, double distance, bool is_explicit);
+    void Rehash(size_t capacity);
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    size_t explicit_size_ = 0;
+};
+
+} // namespace transport
@@ -4,19 +4,16 @@
 
 namespace domain {
 
-Stop::Stop(std::string name, geo::Coordinates coordinates, std::set<std::string_view> buses)
-            : name_(std::move(name)),
+Stop::Stop(std::string_view name, geo::Coordinates coordinates, memory::Arena& arena)
+            : name_(name),
               coordinates_(coordinates),
-              buses_(std::move(buses))
+              buses_(NameSet::allocator_type(arena))
 {
 }
 
-Route::Route(std::string name, std::deque<Stop*> stops, std::set<std::string_view> unique_stops, double geo_distance, double distance, bool is_roundtrip)
-            : name_(std::move(name)),
-              stops_(std::move(stops)),
-              unique_stops_(std::move(unique_stops)),
-              geo_distance_(geo_distance),
-              distance_(distance),
+Bus::Bus(std::string_view name, bool is_roundtrip, memory::Arena& arena)
+            : name_(name),
+              stops_(memory::ArenaAllocator<Stop*>(arena)),
               is_roundtrip_(is_roundtrip)
 {
 }
@@ -28,12 +25,13 @@ StopInfo::StopInfo(std::string name, std::set<std::string_view> buses, bool is_e
 {
 }
 
-RouteInfo::RouteInfo(std::string_view name, size_t stops_count, size_t unique_stops_count, double distance, double curvature)
+BusInfo::BusInfo(std::string_view name, size_t stops_count, size_t unique_stops_count, double distance, double curvature, bool is_exist)
             : name_(name),
               stops_count_(stops_count),
               unique_stops_count_(unique_stops_count),
               distance_(distance),
-              curvature_(curvature)
+              curvature_(curvature),
+              is_exist_(is_exist)
 {
 }
 
@@ -1,41 +1,64 @@
 #pragma once
 
+#include "arena.h"
 #include "geo.h"
+#include "name_pool.h"
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
-#include <deque>
 #include <set>
+#include <vector>
 
 namespace domain {
 
+// Плотные номера остановок и маршрутов в порядке добавления в справочник
+using StopId = uint32_t;
+using BusId = uint32_t;
+
+// Остановки и маршруты живут в арене справочника: имена, списки и множества выделяются там же
+using NameSet = std::set<std::string_view, std::less<std::string_view>, memory::ArenaAllocator<std::string_view>>;
+
 struct Stop
 {
-    Stop() = default;
-    Stop(std::string name,
+    Stop(std::string_view name,
          geo::Coordinates coordinates,
-         std::set<std::string_view> buses);
+         memory::Arena& arena);
 
-    std::string name_;
+    std::string_view name_;
     geo::Coordinates coordinates_;
-    std::set<std::string_view> buses_;
+    NameSet buses_;
+    StopId id_ = 0;
+    NameId name_id_ = 0;
 };
 
-struct Route
+struct Bus
 {
-    Route() = default;
-    Route(std::string name,
-          std::deque<Stop*> stops,
-          std::set<std::string_view> unique_stops,
-          double geo_distance,
-          double distance,
-          bool is_roundtrip);
+    Bus(std::string_view name,
+        bool is_roundtrip,
+        memory::Arena& arena);
 
-    std::string name_;
-    std::deque<Stop*> stops_;
-    std::set<std::string_view> unique_stops_;
-    double geo_distance_;
-    double distance_;
+    std::string_view name_;
+    std::vector<Stop*, memory::ArenaAllocator<Stop*>> stops_;
+    double distance_ = 0.0;
     bool is_roundtrip_;
+    BusId id_ = 0;
+    NameId name_id_ = 0;
+
+    // Статистика маршрута целиком (с обратным ходом для некольцевых), считается один раз при добавлении
+    size_t stops_count_ = 0;
+    size_t unique_stops_count_ = 0;
+    double curvature_ = 0.0;
+};
+
+// Упорядочивает остановки или маршруты по имени
+struct NameLess
+{
+    template <typename T>
+    bool operator()(const T* lhs, const T* rhs) const
+    {
+        return lhs->name_ < rhs->name_;
+    }
 };
 
 struct StopInfo
@@ -50,20 +73,22 @@ struct StopInfo
     bool is_exist_ = true;
 };
 
-struct RouteInfo
+struct BusInfo
 {
-    RouteInfo() = default;
-    RouteInfo(std::string_view name,
+    BusInfo() = default;
+    BusInfo(std::string_view name,
               size_t stops_count = 0,
               size_t unique_stops_count = 0,
               double distance = 0,
-              double curvature = 0.0);
+              double curvature = 0.0,
+              bool is_exist = true);
 
     std::string_view name_;
     size_t stops_count_ = 0;
     size_t unique_stops_count_ = 0;
     double distance_ = 0.0;
     double curvature_ = 0.0;
+    bool is_exist_ = true;
 };
 
 
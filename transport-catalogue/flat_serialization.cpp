@@ -0,0 +1,664 @@
+#include "flat_serialization.h"
+#include "serialization.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace flat {
+
+using namespace std::literals;
+
+static_assert(sizeof(graph::EdgeId) == sizeof(uint64_t), "Dense routes internal data is stored with 64-bit edge ids");
+
+namespace {
+
+size_t AlignOffset(size_t offset)
+{
+    return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string& file)
+{
+    const int fd = open(file.c_str(), O_RDONLY);
+    if(fd == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't open base file "s + file);
+    }
+
+    struct stat file_stat = {};
+    if(fstat(fd, &file_stat) == -1)
+    {
+        const int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "Can't stat base file "s + file);
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+
+    if(size_ != 0)
+    {
+        void* data = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        if(data == MAP_FAILED)
+        {
+            const int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "Can't map base file "s + file);
+        }
+        data_ = static_cast<const char*>(data);
+    }
+
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if(data_ != nullptr)
+    {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+const char* MappedFile::GetData() const
+{
+    return data_;
+}
+
+size_t MappedFile::GetSize() const
+{
+    return size_;
+}
+
+Serializer::Serializer(transport::Catalogue& transport_catalogue,
+                       transport::renderer::MapRenderer& map_renderer,
+                       route::TransportRouter& transport_router) : transport_catalogue_(transport_catalogue),
+                                                                   map_renderer_(map_renderer),
+                                                                   transport_router_(transport_router)
+{
+}
+
+void Serializer::operator()(const std::string& file)
+{
+    SerializationSettings();
+    SerializationNames();
+    SerializationStops();
+    SerializationDistances();
+    SerializationBuses();
+    SerializationStopIndex();
+    SerializationRenderedMap();
+
+    SerializationGraph();
+    SerializationVertexIds();
+    SerializationRouteInfo();
+    SerializationRoutesInternalData();
+    SerializationContractionHierarchy();
+
+    Header header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.section_count = static_cast<uint32_t>(sections_.size());
+    header.vertex_count = transport_router_.GetGraph()->GetVertexCount();
+
+    std::vector<SectionEntry> entries;
+    size_t offset = AlignOffset(sizeof(Header) + sizeof(SectionEntry) * sections_.size());
+    for(const auto& section : sections_)
+    {
+        entries.push_back({section.id, 0, offset, section.size});
+        offset = AlignOffset(offset + section.size);
+    }
+
+    // Файл пишется рядом и подменяет прежний переименованием: отображение старой базы в работающем сервере
+    // остаётся целым, а новый файл никто не прочитает недописанным
+    const std::string temp_file = file + ".tmp"s;
+    std::ofstream out(temp_file, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), sizeof(SectionEntry) * entries.size());
+
+    size_t position = sizeof(Header) + sizeof(SectionEntry) * entries.size();
+    const std::vector<char> padding(SECTION_ALIGNMENT, '\0');
+    for(size_t i = 0; i < sections_.size(); ++i)
+    {
+        out.write(padding.data(), entries[i].offset - position);
+        out.write(sections_[i].data, sections_[i].size);
+        position = entries[i].offset + sections_[i].size;
+    }
+
+    out.close();
+    if(!out)
+    {
+        throw std::runtime_error("Can't write base file "s + file);
+    }
+    if(std::rename(temp_file.c_str(), file.c_str()) != 0)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't replace base file "s + file);
+    }
+}
+
+template <typename T>
+void Serializer::AddSection(SectionId id, const T* data, size_t count)
+{
+    sections_.push_back({id, reinterpret_cast<const char*>(data), sizeof(T) * count});
+}
+
+StringRef Serializer::GetNameRef(std::string_view name) const
+{
+    return name_refs_.at(transport_catalogue_.GetNamePool().Find(name));
+}
+
+void Serializer::SerializationSettings()
+{
+    proto::Serializer proto_serializer(transport_catalogue_, map_renderer_, transport_router_);
+    settings_ = proto_serializer.SerializeSettings();
+
+    AddSection(SectionId::SETTINGS, settings_.data(), settings_.size());
+}
+
+void Serializer::SerializationNames()
+{
+    // Секция строк — это пул имён справочника, записанный подряд
+    const domain::NamePool& names = transport_catalogue_.GetNamePool();
+
+    name_refs_.reserve(names.GetSize());
+    for(domain::NameId id = 0; id < names.GetSize(); ++id)
+    {
+        const std::string_view name = names.GetName(id);
+        name_refs_.push_back({static_cast<uint32_t>(strings_.size()), static_cast<uint32_t>(name.size())});
+        strings_.append(name);
+    }
+
+    AddSection(SectionId::STRINGS, strings_.data(), strings_.size());
+}
+
+void Serializer::SerializationStops()
+{
+    for(const auto& stop : transport_catalogue_.GetStops())
+    {
+        stops_.push_back({name_refs_.at(stop->name_id_), stop->coordinates_.lat, stop->coordinates_.lng});
+    }
+
+    AddSection(SectionId::STOPS, stops_.data(), stops_.size());
+}
+
+void Serializer::SerializationDistances()
+{
+    distances_.reserve(transport_catalogue_.GetAllDistances().GetSize());
+    for(const auto& [stop1, stop2, distance] : transport_catalogue_.GetAllDistances())
+    {
+        distances_.push_back({stop1, stop2, distance});
+    }
+
+    AddSection(SectionId::DISTANCES, distances_.data(), distances_.size());
+}
+
+void Serializer::SerializationBuses()
+{
+    for(const auto& bus : transport_catalogue_.GetBuses())
+    {
+        Bus flat_bus = {};
+        flat_bus.name = name_refs_.at(bus->name_id_);
+        flat_bus.stops_begin = static_cast<uint32_t>(bus_stops_.size());
+        flat_bus.stops_count = static_cast<uint32_t>(bus->stops_.size());
+        flat_bus.is_roundtrip = bus->is_roundtrip_;
+        flat_bus.stop_count = static_cast<uint32_t>(bus->stops_count_);
+        flat_bus.unique_stop_count = static_cast<uint32_t>(bus->unique_stops_count_);
+        flat_bus.route_length = bus->distance_;
+        flat_bus.curvature = bus->curvature_;
+
+        for(const auto& stop : bus->stops_)
+        {
+            bus_stops_.push_back(stop->id_);
+        }
+
+        buses_.push_back(flat_bus);
+    }
+
+    AddSection(SectionId::BUSES, buses_.data(), buses_.size());
+    AddSection(SectionId::BUS_STOPS, bus_stops_.data(), bus_stops_.size());
+}
+
+void Serializer::SerializationStopIndex()
+{
+    const auto& order = transport_catalogue_.GetStopIndex().GetOrder();
+    AddSection(SectionId::STOP_INDEX, order.data(), order.size());
+}
+
+void Serializer::SerializationRenderedMap()
+{
+    if(const auto map = map_renderer_.GetRenderedMap())
+    {
+        AddSection(SectionId::RENDERED_MAP, map->data(), map->size());
+    }
+}
+
+void Serializer::SerializationGraph()
+{
+    const auto& graph = *transport_router_.GetGraph();
+
+    edges_.reserve(graph.GetEdgeCount());
+    for(const auto& edge : graph.GetEdges())
+    {
+        edges_.push_back({edge.from, edge.to, edge.weight});
+    }
+
+    AddSection(SectionId::GRAPH_EDGES, edges_.data(), edges_.size());
+}
+
+void Serializer::SerializationVertexIds()
+{
+    for(const auto& [stop, vertex_ids] : transport_router_.GetStopVertexIds())
+    {
+        stop_vertices_.push_back({transport_catalogue_.FindStop(stop)->id_, 0, vertex_ids.start_wait, vertex_ids.end_wait});
+    }
+
+    AddSection(SectionId::STOP_VERTICES, stop_vertices_.data(), stop_vertices_.size());
+}
+
+void Serializer::SerializationRouteInfo()
+{
+    for(const auto& info : transport_router_.GetEdgesInfo())
+    {
+        edges_info_.push_back({GetNameRef(info.name), info.span_count, 0, info.time});
+    }
+
+    AddSection(SectionId::EDGES_INFO, edges_info_.data(), edges_info_.size());
+}
+
+void Serializer::SerializationRoutesInternalData()
+{
+    const size_t vertex_count = transport_router_.GetGraph()->GetVertexCount();
+
+    switch(transport_router_.GetSettings().router_type)
+    {
+        case route::RouterType::PARALLEL_ALL_PAIRS:
+        {
+            const auto& router = transport_router_.GetBlockedRouter();
+            AddSection(SectionId::ROUTE_WEIGHTS, router.GetWeights(), vertex_count * vertex_count);
+            AddSection(SectionId::ROUTE_PREV_EDGES, router.GetPrevEdges(), vertex_count * vertex_count);
+            break;
+        }
+        case route::RouterType::COMPACT_ALL_PAIRS:
+        {
+            const auto& router = transport_router_.GetCompactRouter();
+            AddSection(SectionId::ROUTE_WEIGHTS, router.GetWeights(), vertex_count * vertex_count);
+            AddSection(SectionId::ROUTE_PREV_EDGES, router.GetPrevEdges(), vertex_count * vertex_count);
+            break;
+        }
+        case route::RouterType::ALL_PAIRS:
+        {
+            // Таблица Router хранится в том же плотном виде, что и у parallel_all_pairs
+            using BlockedRoute = route::TransportRouter::BlockedRoute;
+
+            route_weights_.assign(vertex_count * vertex_count, 0.0);
+            route_prev_edges_.assign(vertex_count * vertex_count, BlockedRoute::NO_ROUTE);
+            for(size_t vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+            {
+                for(size_t vertex_to = 0; vertex_to < vertex_count; ++vertex_to)
+                {
+                    const auto route = transport_router_.GetRouteInternalData(vertex_from, vertex_to);
+                    if(route)
+                    {
+                        const size_t index = vertex_from * vertex_count + vertex_to;
+                        route_weights_[index] = route->weight;
+                        route_prev_edges_[index] = route->prev_edge ? *route->prev_edge : BlockedRoute::NO_EDGE;
+                    }
+                }
+            }
+
+            AddSection(SectionId::ROUTE_WEIGHTS, route_weights_.data(), route_weights_.size());
+            AddSection(SectionId::ROUTE_PREV_EDGES, route_prev_edges_.data(), route_prev_edges_.size());
+            break;
+        }
+        case route::RouterType::DIJKSTRA:
+        case route::RouterType::CONTRACTION_HIERARCHIES:
+            break;
+    }
+}
+
+void Serializer::SerializationContractionHierarchy()
+{
+    if(transport_router_.GetSettings().router_type != route::RouterType::CONTRACTION_HIERARCHIES)
+    {
+        return;
+    }
+
+    const auto& contraction_hierarchy = transport_router_.GetContractionHierarchy();
+
+    hierarchy_ranks_.assign(contraction_hierarchy.GetRanks().begin(), contraction_hierarchy.GetRanks().end());
+    for(const auto& shortcut : contraction_hierarchy.GetShortcuts())
+    {
+        hierarchy_shortcuts_.push_back({shortcut.from, shortcut.to, shortcut.weight, shortcut.first_edge, shortcut.second_edge});
+    }
+
+    AddSection(SectionId::HIERARCHY_RANKS, hierarchy_ranks_.data(), hierarchy_ranks_.size());
+    AddSection(SectionId::HIERARCHY_SHORTCUTS, hierarchy_shortcuts_.data(), hierarchy_shortcuts_.size());
+}
+
+Deserializer::Deserializer(transport::Catalogue& transport_catalogue,
+                           transport::renderer::MapRenderer& map_renderer,
+                           route::TransportRouter& transport_router) : transport_catalogue_(transport_catalogue),
+                                                                       map_renderer_(map_renderer),
+                                                                       transport_router_(transport_router)
+{
+}
+
+void Deserializer::operator()(const std::string& file)
+{
+    mapped_file_ = std::make_shared<const MappedFile>(file);
+
+    DeserializationHeader();
+    DeserializationSettings();
+    DeserializationStops();
+    DeserializationDistances();
+    DeserializationBuses();
+    DeserializationStopIndex();
+    DeserializationRenderedMap();
+
+    DeserializationGraph();
+    DeserializationVertexIds();
+    DeserializationRouteInfo();
+    DeserializationRoutesInternalData();
+    DeserializationContractionHierarchy();
+
+    transport_router_.Build();
+}
+
+template <typename T>
+SectionView<T> Deserializer::GetSection(SectionId id) const
+{
+    for(const auto& entry : sections_)
+    {
+        if(entry.id != id)
+        {
+            continue;
+        }
+
+        if(entry.offset > mapped_file_->GetSize() || entry.size > mapped_file_->GetSize() - entry.offset
+           || entry.offset % alignof(T) != 0 || entry.size % sizeof(T) != 0)
+        {
+            throw std::invalid_argument("Broken section in the flat base file");
+        }
+
+        return {reinterpret_cast<const T*>(mapped_file_->GetData() + entry.offset), entry.size / sizeof(T)};
+    }
+
+    return {};
+}
+
+std::string_view Deserializer::GetString(StringRef ref) const
+{
+    if(ref.offset > strings_.size || ref.size > strings_.size - ref.offset)
+    {
+        throw std::invalid_argument("Broken string in the flat base file");
+    }
+
+    return {strings_.data + ref.offset, ref.size};
+}
+
+void Deserializer::DeserializationHeader()
+{
+    const char* data = mapped_file_->GetData();
+    const size_t size = mapped_file_->GetSize();
+
+    if(size < sizeof(Header) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        throw std::invalid_argument("Not a flat base file");
+    }
+
+    header_ = reinterpret_cast<const Header*>(data);
+    if(header_->version != VERSION)
+    {
+        throw std::invalid_argument("Unsupported flat base file version");
+    }
+    if(header_->section_count > (size - sizeof(Header)) / sizeof(SectionEntry))
+    {
+        throw std::invalid_argument("Broken section table in the flat base file");
+    }
+
+    sections_ = {reinterpret_cast<const SectionEntry*>(data + sizeof(Header)), header_->section_count};
+    strings_ = GetSection<char>(SectionId::STRINGS);
+}
+
+void Deserializer::DeserializationSettings()
+{
+    const auto settings = GetSection<char>(SectionId::SETTINGS);
+    if(settings.size == 0)
+    {
+        throw std::invalid_argument("Broken settings in the flat base file");
+    }
+
+    proto::Deserializer proto_deserializer(transport_catalogue_, map_renderer_, transport_router_);
+    proto_deserializer.DeserializeSettings({settings.data, settings.size});
+}
+
+void Deserializer::DeserializationStops()
+{
+    for(const auto& stop : GetSection<Stop>(SectionId::STOPS))
+    {
+        transport_catalogue_.AddStop(GetString(stop.name), stop.lat, stop.lng);
+    }
+}
+
+void Deserializer::DeserializationDistances()
+{
+    // Остановки добавлены в порядке секции, поэтому их индексы совпадают с номерами в справочнике
+    const size_t stop_count = transport_catalogue_.GetStopCount();
+    for(const auto& distance : GetSection<Distance>(SectionId::DISTANCES))
+    {
+        if(distance.stop_from >= stop_count || distance.stop_to >= stop_count)
+        {
+            throw std::invalid_argument("Broken distance in the flat base file");
+        }
+
+        transport_catalogue_.AddDistance(distance.stop_from, distance.stop_to, distance.distance);
+    }
+}
+
+void Deserializer::DeserializationBuses()
+{
+    const size_t stop_count = transport_catalogue_.GetStopCount();
+    const auto bus_stops = GetSection<uint32_t>(SectionId::BUS_STOPS);
+
+    for(const auto& bus : GetSection<Bus>(SectionId::BUSES))
+    {
+        if(bus.stops_begin > bus_stops.size || bus.stops_count > bus_stops.size - bus.stops_begin)
+        {
+            throw std::invalid_argument("Broken bus in the flat base file");
+        }
+
+        const std::vector<domain::StopId> stop_ids(bus_stops.begin() + bus.stops_begin, bus_stops.begin() + bus.stops_begin + bus.stops_count);
+        for(const domain::StopId stop : stop_ids)
+        {
+            if(stop >= stop_count)
+            {
+                throw std::invalid_argument("Broken bus in the flat base file");
+            }
+        }
+
+        const std::string_view name = GetString(bus.name);
+        const domain::BusInfo bus_info(name, bus.stop_count, bus.unique_stop_count, bus.route_length, bus.curvature);
+        transport_catalogue_.AddBus(name, stop_ids, bus.is_roundtrip != 0, bus_info);
+    }
+}
+
+void Deserializer::DeserializationStopIndex()
+{
+    const auto stop_index = GetSection<uint32_t>(SectionId::STOP_INDEX);
+
+    // Секция появилась позже остальных, в базах без неё индекс строится заново
+    if(stop_index.size != transport_catalogue_.GetStopCount())
+    {
+        transport_catalogue_.BuildStopIndex();
+        return;
+    }
+
+    transport_catalogue_.BuildStopIndex(std::vector<domain::StopId>(stop_index.begin(), stop_index.end()));
+}
+
+void Deserializer::DeserializationRenderedMap()
+{
+    const auto map = GetSection<char>(SectionId::RENDERED_MAP);
+    if(map.size != 0)
+    {
+        map_renderer_.SetRenderedMap(mapped_file_, {map.data, map.size});
+    }
+}
+
+void Deserializer::DeserializationGraph()
+{
+    const auto flat_edges = GetSection<Edge>(SectionId::GRAPH_EDGES);
+
+    std::vector<graph::Edge<double>> edges;
+    edges.reserve(flat_edges.size);
+    for(const auto& edge : flat_edges)
+    {
+        if(edge.from >= header_->vertex_count || edge.to >= header_->vertex_count)
+        {
+            throw std::invalid_argument("Broken graph edge in the flat base file");
+        }
+
+        edges.push_back({edge.from, edge.to, edge.weight});
+    }
+
+    route::TransportRouter::Graph graph;
+    graph.SetGraph(header_->vertex_count, std::move(edges));
+
+    transport_router_.SetGraph(std::move(graph));
+}
+
+void Deserializer::DeserializationVertexIds()
+{
+    const size_t stop_count = transport_catalogue_.GetStopCount();
+    std::unordered_map<std::string_view, route::Vertexe> stop_vertex_ids;
+    for(const auto& stop_vertices : GetSection<StopVertices>(SectionId::STOP_VERTICES))
+    {
+        if(stop_vertices.stop >= stop_count
+           || stop_vertices.start_wait >= header_->vertex_count || stop_vertices.end_wait >= header_->vertex_count)
+        {
+            throw std::invalid_argument("Broken stop vertices in the flat base file");
+        }
+
+        const domain::Stop* stop = transport_catalogue_.FindStop(static_cast<domain::StopId>(stop_vertices.stop));
+        stop_vertex_ids[stop->name_] = {stop_vertices.start_wait, stop_vertices.end_wait};
+    }
+
+    transport_router_.SetStopVertexIds(std::move(stop_vertex_ids));
+}
+
+void Deserializer::DeserializationRouteInfo()
+{
+    const auto& graph = *transport_router_.GetGraph();
+
+    std::vector<route::EdgeInfo> edges_info;
+    edges_info.reserve(graph.GetEdgeCount());
+
+    // Описание есть у каждого ребра графа, и названо оно именем остановки или маршрута из справочника
+    const auto flat_edges_info = GetSection<EdgeInfo>(SectionId::EDGES_INFO);
+    if(flat_edges_info.size != graph.GetEdgeCount())
+    {
+        throw std::invalid_argument("Broken edges info in the flat base file");
+    }
+
+    graph::EdgeId edge_id = 0;
+    for(const auto& info : flat_edges_info)
+    {
+        const std::string_view name = GetString(info.name);
+
+        std::string_view stored_name;
+        if(const domain::Stop* stop = transport_catalogue_.FindStop(name))
+        {
+            stored_name = stop->name_;
+        }
+        else if(const domain::Bus* bus = transport_catalogue_.FindBus(name))
+        {
+            stored_name = bus->name_;
+        }
+        else
+        {
+            throw std::invalid_argument("Broken edges info in the flat base file");
+        }
+
+        edges_info.push_back({graph.GetEdge(edge_id++), stored_name, info.span_count, info.time});
+    }
+
+    transport_router_.SetEdgesInfo(std::move(edges_info));
+}
+
+template <typename StoredWeight, typename StoredEdgeId>
+void Deserializer::DeserializationDenseRoutesInternalData()
+{
+    const size_t cell_count = header_->vertex_count * header_->vertex_count;
+    const auto weights = GetSection<StoredWeight>(SectionId::ROUTE_WEIGHTS);
+    const auto prev_edges = GetSection<StoredEdgeId>(SectionId::ROUTE_PREV_EDGES);
+    if(weights.size != cell_count || prev_edges.size != cell_count)
+    {
+        throw std::invalid_argument("Broken routes in the flat base file");
+    }
+
+    // Роутер сам проверяет, что предыдущие рёбра образуют деревья путей внутри графа
+    try
+    {
+        transport_router_.SetRoutesInternalData(mapped_file_, weights.data, prev_edges.data);
+    }
+    catch(const std::invalid_argument&)
+    {
+        throw std::invalid_argument("Broken routes in the flat base file");
+    }
+}
+
+void Deserializer::DeserializationRoutesInternalData()
+{
+    // Таблица всех пар читается из отображения на месте. У all_pairs она лежит в той же плотной матрице,
+    // что и у parallel_all_pairs, и маршруты по ней ищет тот же BlockedRouter с побитово теми же ответами
+    switch(transport_router_.GetSettings().router_type)
+    {
+        case route::RouterType::ALL_PAIRS:
+        case route::RouterType::PARALLEL_ALL_PAIRS:
+            DeserializationDenseRoutesInternalData<double, graph::EdgeId>();
+            break;
+        case route::RouterType::COMPACT_ALL_PAIRS:
+            DeserializationDenseRoutesInternalData<float, uint32_t>();
+            break;
+        case route::RouterType::DIJKSTRA:
+        case route::RouterType::CONTRACTION_HIERARCHIES:
+            break;
+    }
+}
+
+void Deserializer::DeserializationContractionHierarchy()
+{
+    if(transport_router_.GetSettings().router_type != route::RouterType::CONTRACTION_HIERARCHIES)
+    {
+        return;
+    }
+
+    const auto flat_ranks = GetSection<uint64_t>(SectionId::HIERARCHY_RANKS);
+    std::vector<size_t> ranks(flat_ranks.begin(), flat_ranks.end());
+
+    std::vector<route::TransportRouter::HierarchyRoute::Shortcut> shortcuts;
+    for(const auto& shortcut : GetSection<Shortcut>(SectionId::HIERARCHY_SHORTCUTS))
+    {
+        shortcuts.push_back({shortcut.from, shortcut.to, shortcut.weight, shortcut.first_edge, shortcut.second_edge});
+    }
+
+    // Иерархия проверяет ранги и сокращения в конструкторе
+    try
+    {
+        transport_router_.SetContractionHierarchy(std::move(ranks), std::move(shortcuts));
+    }
+    catch(const std::invalid_argument&)
+    {
+        throw std::invalid_argument("Broken contraction hierarchy in the flat base file");
+    }
+}
+
+} // namespace flat
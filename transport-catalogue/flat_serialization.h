@@ -0,0 +1,273 @@
+#pragma once
+
+#include "transport_catalogue.h"
+#include "map_renderer.h"
+#include "transport_router.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace flat {
+
+// Плоский формат базы: заголовок, таблица секций и сами секции, выровненные по SECTION_ALIGNMENT.
+// Числа записаны в порядке байт машины, собиравшей базу.
+// process_requests отображает файл в память и читает секции на месте без разбора protobuf.
+// Прямо из отображения, без копирования, используются матрицы маршрутов all_pairs, parallel_all_pairs
+// и compact_all_pairs и готовая карта - это почти весь объём файла.
+// Справочник, граф, описания рёбер и иерархия сокращений пока собираются из секций в обычные структуры:
+// это линейный проход без разбора, но с выделением памяти под хеш-таблицы и CSR графа
+
+const char MAGIC[8] = {'T', 'C', 'F', 'L', 'A', 'T', '\0', '\0'};
+const uint32_t VERSION = 2;
+const size_t SECTION_ALIGNMENT = 64;
+
+enum class SectionId : uint32_t
+{
+    SETTINGS = 1,
+    STRINGS,
+    STOPS,
+    BUSES,
+    BUS_STOPS,
+    DISTANCES,
+    GRAPH_EDGES,
+    STOP_VERTICES,
+    EDGES_INFO,
+    ROUTE_WEIGHTS,
+    ROUTE_PREV_EDGES,
+    HIERARCHY_RANKS,
+    HIERARCHY_SHORTCUTS,
+    STOP_INDEX,
+    RENDERED_MAP,
+};
+
+struct Header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t section_count;
+    uint64_t vertex_count;
+};
+
+struct SectionEntry
+{
+    SectionId id;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t size;
+};
+
+// Строка в секции STRINGS
+struct StringRef
+{
+    uint32_t offset;
+    uint32_t size;
+};
+
+struct Stop
+{
+    StringRef name;
+    double lat;
+    double lng;
+};
+
+// Остановки маршрута - отрезок секции BUS_STOPS с индексами остановок,
+// дальше - посчитанная при сборке базы статистика маршрута
+struct Bus
+{
+    StringRef name;
+    uint32_t stops_begin;
+    uint32_t stops_count;
+    uint32_t is_roundtrip;
+    uint32_t stop_count;
+    uint32_t unique_stop_count;
+    uint32_t reserved;
+    double route_length;
+    double curvature;
+};
+
+struct Distance
+{
+    uint32_t stop_from;
+    uint32_t stop_to;
+    double distance;
+};
+
+struct Edge
+{
+    uint64_t from;
+    uint64_t to;
+    double weight;
+};
+
+struct StopVertices
+{
+    uint32_t stop;
+    uint32_t reserved;
+    uint64_t start_wait;
+    uint64_t end_wait;
+};
+
+// Ребро графа с тем же индексом лежит в секции GRAPH_EDGES
+struct EdgeInfo
+{
+    StringRef name;
+    int32_t span_count;
+    uint32_t reserved;
+    double time;
+};
+
+struct Shortcut
+{
+    uint64_t from;
+    uint64_t to;
+    double weight;
+    uint64_t first_edge;
+    uint64_t second_edge;
+};
+
+// Файл, отображённый в память только для чтения
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& file);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* GetData() const;
+    size_t GetSize() const;
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename T>
+struct SectionView
+{
+    const T* data = nullptr;
+    size_t size = 0;
+
+    const T* begin() const
+    {
+        return data;
+    }
+
+    const T* end() const
+    {
+        return data + size;
+    }
+
+    const T& operator[](size_t index) const
+    {
+        return data[index];
+    }
+
+    const T& at(size_t index) const
+    {
+        if(index >= size)
+        {
+            throw std::out_of_range("Index is out of the flat base section");
+        }
+        return data[index];
+    }
+};
+
+class Serializer
+{
+public:
+    Serializer(transport::Catalogue& transport_catalogue, transport::renderer::MapRenderer& map_renderer, route::TransportRouter& transport_router);
+    void operator()(const std::string& file);
+
+private:
+    struct Section
+    {
+        SectionId id;
+        const char* data;
+        size_t size;
+    };
+
+    transport::Catalogue& transport_catalogue_;
+    transport::renderer::MapRenderer& map_renderer_;
+    route::TransportRouter& transport_router_;
+
+    std::vector<Section> sections_;
+
+    std::string settings_;
+    std::string strings_;
+    // Ссылка на строку в секции STRINGS для каждого имени из пула справочника
+    std::vector<StringRef> name_refs_;
+
+    std::vector<Stop> stops_;
+    std::vector<Bus> buses_;
+    std::vector<uint32_t> bus_stops_;
+    std::vector<Distance> distances_;
+    std::vector<Edge> edges_;
+    std::vector<StopVertices> stop_vertices_;
+    std::vector<EdgeInfo> edges_info_;
+    std::vector<double> route_weights_;
+    std::vector<uint64_t> route_prev_edges_;
+    std::vector<uint64_t> hierarchy_ranks_;
+    std::vector<Shortcut> hierarchy_shortcuts_;
+
+    template <typename T>
+    void AddSection(SectionId id, const T* data, size_t count);
+    StringRef GetNameRef(std::string_view name) const;
+
+    void SerializationSettings();
+    void SerializationNames();
+    void SerializationStops();
+    void SerializationDistances();
+    void SerializationBuses();
+    void SerializationStopIndex();
+    void SerializationRenderedMap();
+    void SerializationGraph();
+    void SerializationVertexIds();
+    void SerializationRouteInfo();
+    void SerializationRoutesInternalData();
+    void SerializationContractionHierarchy();
+};
+
+class Deserializer
+{
+public:
+    Deserializer(transport::Catalogue& transport_catalogue, transport::renderer::MapRenderer& map_renderer, route::TransportRouter& transport_router);
+    void operator()(const std::string& file);
+
+private:
+    transport::Catalogue& transport_catalogue_;
+    transport::renderer::MapRenderer& map_renderer_;
+    route::TransportRouter& transport_router_;
+
+    std::shared_ptr<const MappedFile> mapped_file_;
+    const Header* header_ = nullptr;
+    SectionView<SectionEntry> sections_;
+    SectionView<char> strings_;
+
+    template <typename T>
+    SectionView<T> GetSection(SectionId id) const;
+    std::string_view GetString(StringRef ref) const;
+
+    void DeserializationHeader();
+    void DeserializationSettings();
+    void DeserializationStops();
+    void DeserializationDistances();
+    void DeserializationBuses();
+    void DeserializationStopIndex();
+    void DeserializationRenderedMap();
+    void DeserializationGraph();
+    void DeserializationVertexIds();
+    void DeserializationRouteInfo();
+    void DeserializationRoutesInternalData();
+    template <typename StoredWeight, typename StoredEdgeId>
+    void DeserializationDenseRoutesInternalData();
+    void DeserializationContractionHierarchy();
+};
+
+} // namespace flat
@@ -1,8 +1,11 @@
 #include "geo.h"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#define GEO_HAS_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
 namespace geo {
-    
-inline const int RADIUS_EARTH = 6371000;
 
 double ComputeDistance(Coordinates from, Coordinates to)
 {
@@ -18,4 +21,127 @@ double ComputeDistance(Coordinates from, Coordinates to)
                 * RADIUS_EARTH;
 }
 
+void CoordinateTable::Add(Coordinates coordinates)
+{
+    lat_.push_back(coordinates.lat);
+    lng_.push_back(coordinates.lng);
+    lat_sin_.push_back(std::sin(coordinates.lat * DR));
+    lat_cos_.push_back(std::cos(coordinates.lat * DR));
+}
+
+size_t CoordinateTable::GetSize() const
+{
+    return lat_.size();
+}
+
+double CoordinateTable::ComputeDistance(uint32_t from, uint32_t to) const
+{
+    return std::acos(ComputeCosine(from, to)) * RADIUS_EARTH;
+}
+
+// Косинус центрального угла. Для совпадающих точек это ровно 1, и acos даёт ровно 0, как в geo::ComputeDistance
+double CoordinateTable::ComputeCosine(uint32_t from, uint32_t to) const
+{
+    if(lat_[from] == lat_[to] && lng_[from] == lng_[to])
+    {
+        return 1.0;
+    }
+
+    return lat_sin_[from] * lat_sin_[to]
+           + lat_cos_[from] * lat_cos_[to]
+           * std::cos(std::abs(lng_[from] - lng_[to]) * DR);
+}
+
+void CoordinateTable::ComputeDistances(const uint32_t* from, const uint32_t* to, size_t count, double* out) const
+{
+#ifdef GEO_HAS_AVX2_KERNEL
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if(has_avx2)
+    {
+        ComputeCosinesAvx2(from, to, count, out);
+    }
+    else
+#endif
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            out[i] = ComputeCosine(from[i], to[i]);
+        }
+    }
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        out[i] = std::acos(out[i]) * RADIUS_EARTH;
+    }
+}
+
+#ifdef GEO_HAS_AVX2_KERNEL
+
+namespace {
+
+// Сборка четырёх double по индексам. Исходный регистр и маска заданы явно: с _mm256_i32gather_pd
+// GCC предупреждает, что неявный исходный регистр может быть не инициализирован
+__attribute__((target("avx2")))
+inline __m256d Gather(const double* base, __m128i index)
+{
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+}
+
+} // namespace
+
+// Те же операции в том же порядке, что и в ComputeCosine, только без FMA, иначе округление разойдётся
+__attribute__((target("avx2")))
+void CoordinateTable::ComputeCosinesAvx2(const uint32_t* from, const uint32_t* to, size_t count, double* out) const
+{
+    const __m256d dr = _mm256_set1_pd(DR);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+    {
+        const __m128i index_from = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+        const __m128i index_to = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + i));
+
+        const __m256d lat_from = Gather(lat_.data(), index_from);
+        const __m256d lat_to = Gather(lat_.data(), index_to);
+        const __m256d lng_from = Gather(lng_.data(), index_from);
+        const __m256d lng_to = Gather(lng_.data(), index_to);
+
+        alignas(32) double delta[4];
+        _mm256_store_pd(delta, _mm256_mul_pd(_mm256_andnot_pd(sign, _mm256_sub_pd(lng_from, lng_to)), dr));
+        for(double& value : delta)
+        {
+            value = std::cos(value);
+        }
+
+        const __m256d sin_product = _mm256_mul_pd(Gather(lat_sin_.data(), index_from),
+                                                  Gather(lat_sin_.data(), index_to));
+        const __m256d cos_product = _mm256_mul_pd(Gather(lat_cos_.data(), index_from),
+                                                  Gather(lat_cos_.data(), index_to));
+        const __m256d cosine = _mm256_add_pd(sin_product, _mm256_mul_pd(cos_product, _mm256_load_pd(delta)));
+
+        const __m256d same = _mm256_and_pd(_mm256_cmp_pd(lat_from, lat_to, _CMP_EQ_OQ),
+                                           _mm256_cmp_pd(lng_from, lng_to, _CMP_EQ_OQ));
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(cosine, one, same));
+    }
+
+    for(; i < count; ++i)
+    {
+        out[i] = ComputeCosine(from[i], to[i]);
+    }
+}
+
+#else
+
+void CoordinateTable::ComputeCosinesAvx2(const uint32_t* from, const uint32_t* to, size_t count, double* out) const
+{
+    for(size_t i = 0; i < count; ++i)
+    {
+        out[i] = ComputeCosine(from[i], to[i]);
+    }
+}
+
+#endif
+
 } // namespace geo
@@ -1,27 +1,55 @@
-#pragma once
-
-#include <cmath>
-
-namespace geo
-{
-    
-const double DR = M_PI / 180.;
-
-struct Coordinates
-{
-    double lat;
-    double lng;
-    bool operator==(const Coordinates& other) const
-    {
-        return lat == other.lat && lng == other.lng;
-    }
-
-    bool operator!=(const Coordinates& other) const
-    {
-        return !(*this == other);
-    }
-};
-
-double ComputeDistance(Coordinates from, Coordinates to);
-
-} // namespace geo
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geo
+{
+    
+const double DR = M_PI / 180.;
+const int RADIUS_EARTH = 6371000;
+
+struct Coordinates
+{
+    double lat;
+    double lng;
+    bool operator==(const Coordinates& other) const
+    {
+        return lat == other.lat && lng == other.lng;
+    }
+
+    bool operator!=(const Coordinates& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+double ComputeDistance(Coordinates from, Coordinates to);
+
+// Координаты точек структурой массивов: синус и косинус широты посчитаны заранее,
+// поэтому расстояние между двумя точками стоит одного cos и одного acos
+class CoordinateTable
+{
+public:
+    void Add(Coordinates coordinates);
+    size_t GetSize() const;
+
+    double ComputeDistance(uint32_t from, uint32_t to) const;
+
+    // Расстояния между точками from[i] и to[i]. На x86-64 с AVX2 выборка и арифметика идут по четыре пары сразу,
+    // cos и acos берутся из той же libm, поэтому результат совпадает с geo::ComputeDistance бит в бит
+    void ComputeDistances(const uint32_t* from, const uint32_t* to, size_t count, double* out) const;
+
+private:
+    double ComputeCosine(uint32_t from, uint32_t to) const;
+    void ComputeCosinesAvx2(const uint32_t* from, const uint32_t* to, size_t count, double* out) const;
+
+    std::vector<double> lat_;
+    std::vector<double> lng_;
+    std::vector<double> lat_sin_;
+    std::vector<double> lat_cos_;
+};
+
+} // namespace geo
@@ -3,6 +3,8 @@
 #include "ranges.h"
 
 #include <cstdlib>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace graph {
@@ -18,29 +20,52 @@ struct Edge
     Weight weight;
 };
 
+// Исходящее ребро в замороженном графе: всё нужное для релаксации лежит подряд в памяти
+template <typename Weight>
+struct IncidentEdge
+{
+    VertexId to;
+    Weight weight;
+    EdgeId id;
+};
+
+// Пока граф строится, рёбра вершины хранятся в отдельных списках.
+// Freeze() перекладывает их в CSR: общий массив исходящих рёбер и массив смещений по вершинам.
+// Алгоритмы маршрутизации работают с замороженным графом через GetAdjacentEdges
 template <typename Weight>
 class DirectedWeightedGraph
 {
 private:
     using IncidenceList = std::vector<EdgeId>;
     using IncidentEdgesRange = ranges::Range<typename IncidenceList::const_iterator>;
+    using AdjacentEdgesRange = ranges::Range<typename std::vector<IncidentEdge<Weight>>::const_iterator>;
 
 public:
     DirectedWeightedGraph() = default;
     explicit DirectedWeightedGraph(size_t vertex_count);
     EdgeId AddEdge(const Edge<Weight>& edge);
 
+    void Freeze();
+    bool IsFrozen() const;
+
     size_t GetVertexCount() const;
     size_t GetEdgeCount() const;
     const Edge<Weight>& GetEdge(EdgeId edge_id) const;
     IncidentEdgesRange GetIncidentEdges(VertexId vertex) const;
-    std::vector<Edge<Weight>> GetEdges();
-    std::vector<std::vector<EdgeId>> GetIncidenceLists();
+    AdjacentEdgesRange GetAdjacentEdges(VertexId vertex) const;
+    const std::vector<Edge<Weight>>& GetEdges() const;
+    std::vector<std::vector<EdgeId>> GetIncidenceLists() const;
     void SetGraph(std::vector<Edge<Weight>> edges, std::vector<IncidenceList> incidence_lists);
+    void SetGraph(size_t vertex_count, std::vector<Edge<Weight>> edges);
 
 private:
     std::vector<Edge<Weight>> edges_;
     std::vector<IncidenceList> incidence_lists_;
+
+    bool is_frozen_ = false;
+    std::vector<size_t> offsets_;
+    std::vector<EdgeId> incident_edge_ids_;
+    std::vector<IncidentEdge<Weight>> adjacent_edges_;
 };
 
 template <typename Weight>
@@ -51,16 +76,60 @@ DirectedWeightedGraph<Weight>::DirectedWeightedGraph(size_t vertex_count) : inci
 template <typename Weight>
 EdgeId DirectedWeightedGraph<Weight>::AddEdge(const Edge<Weight>& edge)
 {
+    if(is_frozen_)
+    {
+        throw std::logic_error("Can't add an edge to a frozen graph");
+    }
+
     edges_.push_back(edge);
     const EdgeId id = edges_.size() - 1;
     incidence_lists_.at(edge.from).push_back(id);
     return id;
 }
 
+template <typename Weight>
+void DirectedWeightedGraph<Weight>::Freeze()
+{
+    if(is_frozen_)
+    {
+        return;
+    }
+
+    const size_t vertex_count = incidence_lists_.size();
+    offsets_.assign(vertex_count + 1, 0);
+    for(VertexId vertex = 0; vertex < vertex_count; ++vertex)
+    {
+        offsets_[vertex + 1] = offsets_[vertex] + incidence_lists_[vertex].size();
+    }
+
+    incident_edge_ids_.clear();
+    incident_edge_ids_.reserve(offsets_.back());
+    adjacent_edges_.clear();
+    adjacent_edges_.reserve(offsets_.back());
+    for(const IncidenceList& incidence_list : incidence_lists_)
+    {
+        for(const EdgeId edge_id : incidence_list)
+        {
+            const Edge<Weight>& edge = edges_.at(edge_id);
+            incident_edge_ids_.push_back(edge_id);
+            adjacent_edges_.push_back({edge.to, edge.weight, edge_id});
+        }
+    }
+
+    std::vector<IncidenceList>().swap(incidence_lists_);
+    is_frozen_ = true;
+}
+
+template <typename Weight>
+bool DirectedWeightedGraph<Weight>::IsFrozen() const
+{
+    return is_frozen_;
+}
+
 template <typename Weight>
 size_t DirectedWeightedGraph<Weight>::GetVertexCount() const
 {
-    return incidence_lists_.size();
+    return is_frozen_ ? offsets_.size() - 1 : incidence_lists_.size();
 }
 
 template <typename Weight>
@@ -79,19 +148,47 @@ template <typename Weight>
 typename DirectedWeightedGraph<Weight>::IncidentEdgesRange
 DirectedWeightedGraph<Weight>::GetIncidentEdges(VertexId vertex) const
 {
+    if(is_frozen_)
+    {
+        return {incident_edge_ids_.begin() + offsets_.at(vertex), incident_edge_ids_.begin() + offsets_.at(vertex + 1)};
+    }
+
     return ranges::AsRange(incidence_lists_.at(vertex));
 }
 
 template <typename Weight>
-std::vector<Edge<Weight>> DirectedWeightedGraph<Weight>::GetEdges()
+typename DirectedWeightedGraph<Weight>::AdjacentEdgesRange
+DirectedWeightedGraph<Weight>::GetAdjacentEdges(VertexId vertex) const
+{
+    if(!is_frozen_)
+    {
+        throw std::logic_error("Graph should be frozen before routing");
+    }
+
+    return {adjacent_edges_.begin() + offsets_[vertex], adjacent_edges_.begin() + offsets_[vertex + 1]};
+}
+
+template <typename Weight>
+const std::vector<Edge<Weight>>& DirectedWeightedGraph<Weight>::GetEdges() const
 {
     return edges_;
 }
 
 template <typename Weight>
-std::vector<std::vector<EdgeId>> DirectedWeightedGraph<Weight>::GetIncidenceLists()
+std::vector<std::vector<EdgeId>> DirectedWeightedGraph<Weight>::GetIncidenceLists() const
 {
-    return incidence_lists_;
+    if(!is_frozen_)
+    {
+        return incidence_lists_;
+    }
+
+    std::vector<IncidenceList> incidence_lists(GetVertexCount());
+    for(VertexId vertex = 0; vertex < incidence_lists.size(); ++vertex)
+    {
+        incidence_lists[vertex].assign(incident_edge_ids_.begin() + offsets_[vertex], incident_edge_ids_.begin() + offsets_[vertex + 1]);
+    }
+
+    return incidence_lists;
 }
 
 template <typename Weight>
@@ -99,6 +196,39 @@ void DirectedWeightedGraph<Weight>::SetGraph(std::vector<Edge<Weight>> edges, st
 {
     edges_ = std::move(edges);
     incidence_lists_ = std::move(incidence_lists);
+    is_frozen_ = false;
+}
+
+// Восстанавливает сразу замороженный граф: списки инцидентности однозначно задаются
+// рёбрами, упорядоченными по id, поэтому CSR строится подсчётом без промежуточных списков
+template <typename Weight>
+void DirectedWeightedGraph<Weight>::SetGraph(size_t vertex_count, std::vector<Edge<Weight>> edges)
+{
+    edges_ = std::move(edges);
+    std::vector<IncidenceList>().swap(incidence_lists_);
+
+    offsets_.assign(vertex_count + 1, 0);
+    for(const Edge<Weight>& edge : edges_)
+    {
+        ++offsets_.at(edge.from + 1);
+    }
+    for(VertexId vertex = 0; vertex < vertex_count; ++vertex)
+    {
+        offsets_[vertex + 1] += offsets_[vertex];
+    }
+
+    std::vector<size_t> positions(offsets_.begin(), offsets_.end() - 1);
+    incident_edge_ids_.resize(edges_.size());
+    adjacent_edges_.resize(edges_.size());
+    for(EdgeId edge_id = 0; edge_id < edges_.size(); ++edge_id)
+    {
+        const Edge<Weight>& edge = edges_[edge_id];
+        const size_t position = positions[edge.from]++;
+        incident_edge_ids_[position] = edge_id;
+        adjacent_edges_[position] = {edge.to, edge.weight, edge_id};
+    }
+
+    is_frozen_ = true;
 }
 
 }  // namespace graph
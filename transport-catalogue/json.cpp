@@ -1,206 +1,567 @@
 #include "json.h"
 #include <algorithm>
+#include <charconv>
+#include <system_error>
 
 using namespace std;
 
 namespace json {
 
-Node LoadNode(istream& input);
+namespace {
 
-Node LoadArray(istream& input)
+bool IsDigit(char c)
 {
-    Array result;
-    char c;
-    while (input >> c)
+    return c >= '0' && c <= '9';
+}
+
+bool IsSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+bool IsNumberChar(char c)
+{
+    return IsDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+// Число из символов [begin, end): целое, если в записи нет точки и экспоненты
+Node ParseNumber(const char* begin, const char* end)
+{
+    if(std::any_of(begin, end, [](char c) { return c == '.' || c == 'e' || c == 'E'; }))
     {
-        if(c == ']')
+        double value = 0.0;
+        const auto result = from_chars(begin, end, value);
+        if(result.ec != errc{} || result.ptr != end)
         {
-            return {move(result)};
+            throw ParsingError("Number parsing error"s);
         }
-        if (c != ',')
-        {
-            input.putback(c);
-        }
-        result.push_back(LoadNode(input));
+        return {value};
     }
 
-    throw json::ParsingError("Array parsing error"s);
+    int value = 0;
+    const auto result = from_chars(begin, end, value);
+    if(result.ec != errc{} || result.ptr != end)
+    {
+        throw ParsingError("Number parsing error"s);
+    }
+    return {value};
 }
 
-Node LoadNumber(istream& input)
+// Символ, записанный в строке через обратную косую черту
+char Unescape(char c)
 {
-    std::string str;
+    switch(c)
+    {
+        case '"':
+            return '"';
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case '\\':
+            return '\\';
+        case 't':
+            return '\t';
+        default:
+            throw ParsingError("Bad string"s);
+    }
+}
 
-    while(isdigit(input.peek())
-       || input.peek() == '.'
-       || input.peek() == 'e'
-       || input.peek() == 'E'
-       || input.peek() == '-'
-       || input.peek() == '+')
+// Разбор JSON из непрерывного буфера: указатель идёт по тексту, числа читаются через from_chars,
+// строки без экранирования копируются одним куском
+class Parser
+{
+public:
+    explicit Parser(std::string_view input) : pos_(input.data()), end_(input.data() + input.size())
     {
-        str.push_back(input.get());
     }
 
-    std::size_t found_point = str.find('.');
-    std::size_t found_e = str.find('e');
-    std::size_t found_E = str.find('E');
-    if(found_point != std::string::npos || found_e != std::string::npos || found_E != std::string::npos)
+    Node LoadNode()
     {
-        return {stod(str)};
+        const char c = NextChar("Data not found"s);
+
+        if(IsDigit(c) || c == '-')
+        {
+            return LoadNumber();
+        }
+        else if(c == 't' || c == 'f')
+        {
+            return LoadBool();
+        }
+        else if(c == '"')
+        {
+            ++pos_;
+            return {ParseString()};
+        }
+        else if(c == 'n')
+        {
+            return LoadNull();
+        }
+        else if(c == '[')
+        {
+            ++pos_;
+            return LoadArray();
+        }
+        else if(c == '{')
+        {
+            ++pos_;
+            return LoadDict();
+        }
+        else
+        {
+            throw ParsingError("Parsing error"s);
+        }
     }
-    else
+
+private:
+    // Пропускает пробелы и возвращает следующий символ, не забирая его
+    char NextChar(const std::string& error)
     {
-        return {stoi(str)};
+        while(pos_ != end_ && IsSpace(*pos_))
+        {
+            ++pos_;
+        }
+        if(pos_ == end_)
+        {
+            throw ParsingError(error);
+        }
+
+        return *pos_;
     }
-}
 
-Node LoadString(istream& input)
-{
-    string str;
-    for (char c; input >> std::noskipws >> c;)
+    Node LoadArray()
     {
-        if (c == '"')
+        Array result;
+        if(NextChar("Array parsing error"s) == ']')
         {
-            input >> std::skipws;
-            return {move(str)};
+            ++pos_;
+            return {move(result)};
         }
-        if (c == '\\')
+
+        while(true)
         {
-            input >> c;
-            switch (c)
+            result.push_back(LoadNode());
+
+            const char c = NextChar("Array parsing error"s);
+            ++pos_;
+            if(c == ']')
             {
-                case '"':
-                    str.push_back('"');
-                    break;
-                case 'n':
-                    str.push_back('\n');
-                    break;
-                case 'r':
-                    str.push_back('\r');
-                    break;
-                case '\\':
-                    str.push_back('\\');
-                    break;
-                case 't':
-                    str.push_back('\t');
-                    break;
-                default:
-                    input >> std::skipws;
-                    throw json::ParsingError("Bad string"s);
+                return {move(result)};
+            }
+            if(c != ',')
+            {
+                throw ParsingError("Array parsing error"s);
             }
         }
-        else
+    }
+
+    Node LoadNumber()
+    {
+        const char* begin = pos_;
+        while(pos_ != end_ && IsNumberChar(*pos_))
         {
-            str.push_back(c);
+            ++pos_;
         }
+
+        return ParseNumber(begin, pos_);
     }
 
-    throw json::ParsingError("String parsing error"s);
-}
+    // Открывающая кавычка уже пропущена
+    string ParseString()
+    {
+        const char* begin = pos_;
+        while(pos_ != end_ && *pos_ != '"' && *pos_ != '\\')
+        {
+            ++pos_;
+        }
+        if(pos_ == end_)
+        {
+            throw ParsingError("String parsing error"s);
+        }
 
-Node LoadDict(istream& input)
-{
-    Dict result;
-    char c;
-    while (input >> c)
+        string str(begin, pos_);
+        if(*pos_ == '"')
+        {
+            ++pos_;
+            return str;
+        }
+
+        // Медленный путь: в строке есть экранированные символы
+        while(pos_ != end_)
+        {
+            const char c = *pos_++;
+            if(c == '"')
+            {
+                return str;
+            }
+            if(c != '\\')
+            {
+                str.push_back(c);
+                continue;
+            }
+
+            if(pos_ == end_)
+            {
+                break;
+            }
+            str.push_back(Unescape(*pos_++));
+        }
+
+        throw ParsingError("String parsing error"s);
+    }
+
+    Node LoadDict()
     {
-        if(c == '}')
+        Dict result;
+        if(NextChar("Dictionaty parsing error"s) == '}')
         {
+            ++pos_;
             return {move(result)};
         }
 
-        if(c == ',')
+        while(true)
         {
-            input >> c;
-        }
+            if(NextChar("Dictionaty parsing error"s) != '"')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+            ++pos_;
+            string key = ParseString();
 
-        string key = LoadString(input).AsString();
-        input >> c;
-        result.insert({ move(key), LoadNode(input) });
+            if(NextChar("Dictionaty parsing error"s) != ':')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+            ++pos_;
+            result.emplace(move(key), LoadNode());
+
+            const char c = NextChar("Dictionaty parsing error"s);
+            ++pos_;
+            if(c == '}')
+            {
+                return {move(result)};
+            }
+            if(c != ',')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+        }
     }
 
-    throw json::ParsingError("Dictionaty parsing error"s);
-}
+    bool SkipWord(std::string_view word)
+    {
+        if(static_cast<size_t>(end_ - pos_) < word.size() || std::string_view(pos_, word.size()) != word)
+        {
+            return false;
+        }
 
-Node LoadNull(std::istream& input)
-{
-    string str(4, '\0');
-    for(size_t i = 0; i < 4; ++i)
+        pos_ += word.size();
+        return true;
+    }
+
+    Node LoadNull()
     {
-        input >> str[i];
+        if(SkipWord("null"sv))
+        {
+            return {nullptr};
+        }
+
+        throw ParsingError("Parsing: null error"s);
     }
 
-    if(str == "null")
+    Node LoadBool()
     {
-        return {nullptr};
+        if(SkipWord("true"sv))
+        {
+            return {true};
+        }
+        if(SkipWord("false"sv))
+        {
+            return {false};
+        }
+
+        throw ParsingError("Parsing bool error"s);
     }
 
-    throw json::ParsingError("Parsing: null error"s);
-}
+    const char* pos_;
+    const char* end_;
+};
 
-Node LoadBool(std::istream& input)
+// Потоковый разбор: вместо узлов вызывает методы Handler. Текст из потока читается блоками,
+// при дочитывании уже разобранное начало буфера отбрасывается
+class EventParser
 {
-    string str(5, '\0');
-
-    for(size_t i = 0; i < 4; ++i)
+public:
+    EventParser(std::istream& input, Handler& handler) : input_(&input), handler_(handler)
     {
-        input >> str[i];
     }
 
-    if (str.substr(0, 4) == "true")
+    EventParser(std::string_view input, Handler& handler) : input_(nullptr), handler_(handler), data_(input)
     {
-        return {true};
     }
 
-    input >> str[4];
-    if(str == "false")
+    void ParseValue()
     {
-        return {false};
+        const char c = NextChar("Data not found"s);
+
+        if(IsDigit(c) || c == '-')
+        {
+            ParseNumber();
+        }
+        else if(c == 't')
+        {
+            ExpectWord("true"sv, "Parsing bool error"s);
+            handler_.OnBool(true);
+        }
+        else if(c == 'f')
+        {
+            ExpectWord("false"sv, "Parsing bool error"s);
+            handler_.OnBool(false);
+        }
+        else if(c == '"')
+        {
+            ++pos_;
+            handler_.OnString(ParseString());
+        }
+        else if(c == 'n')
+        {
+            ExpectWord("null"sv, "Parsing: null error"s);
+            handler_.OnNull();
+        }
+        else if(c == '[')
+        {
+            ++pos_;
+            ParseArray();
+        }
+        else if(c == '{')
+        {
+            ++pos_;
+            ParseDict();
+        }
+        else
+        {
+            throw ParsingError("Parsing error"s);
+        }
     }
 
-    throw json::ParsingError("Parsing bool error"s);
-}
+private:
+    static constexpr size_t BLOCK_SIZE = 1 << 16;
 
-Node LoadNode(std::istream& input)
-{
-    char c;
-    if (!(input >> c))
+    // Дочитывает следующий блок, сохраняя символы начиная с keep_from; позиции в буфере сдвигаются на keep_from
+    bool Refill(size_t keep_from)
     {
-        throw ParsingError("Data not found"s);
-    }
+        if(input_ == nullptr)
+        {
+            return false;
+        }
 
-    if(isdigit(c) || c == '-')
-    {
-        input.putback(c);
-        return LoadNumber(input);
+        buffer_.erase(0, keep_from);
+        pos_ -= keep_from;
+
+        const size_t old_size = buffer_.size();
+        buffer_.resize(old_size + BLOCK_SIZE);
+        input_->read(buffer_.data() + old_size, BLOCK_SIZE);
+        buffer_.resize(old_size + input_->gcount());
+        data_ = buffer_;
+
+        return buffer_.size() > old_size;
     }
-    else if(c == 't' || c == 'f')
+
+    char NextChar(const std::string& error)
     {
-        input.putback(c);
-        return LoadBool(input);
+        while(true)
+        {
+            while(pos_ != data_.size() && IsSpace(data_[pos_]))
+            {
+                ++pos_;
+            }
+            if(pos_ != data_.size())
+            {
+                return data_[pos_];
+            }
+            if(!Refill(pos_))
+            {
+                throw ParsingError(error);
+            }
+        }
     }
-    else if(c == '"')
+
+    void ParseArray()
     {
-        return LoadString(input);
+        handler_.StartArray();
+        if(NextChar("Array parsing error"s) == ']')
+        {
+            ++pos_;
+            handler_.EndArray();
+            return;
+        }
+
+        while(true)
+        {
+            ParseValue();
+
+            const char c = NextChar("Array parsing error"s);
+            ++pos_;
+            if(c == ']')
+            {
+                handler_.EndArray();
+                return;
+            }
+            if(c != ',')
+            {
+                throw ParsingError("Array parsing error"s);
+            }
+        }
     }
-    else if(c == 'n')
+
+    void ParseDict()
     {
-        input.putback(c);
-        return LoadNull(input);
+        handler_.StartDict();
+        if(NextChar("Dictionaty parsing error"s) == '}')
+        {
+            ++pos_;
+            handler_.EndDict();
+            return;
+        }
+
+        while(true)
+        {
+            if(NextChar("Dictionaty parsing error"s) != '"')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+            ++pos_;
+            handler_.OnKey(ParseString());
+
+            if(NextChar("Dictionaty parsing error"s) != ':')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+            ++pos_;
+            ParseValue();
+
+            const char c = NextChar("Dictionaty parsing error"s);
+            ++pos_;
+            if(c == '}')
+            {
+                handler_.EndDict();
+                return;
+            }
+            if(c != ',')
+            {
+                throw ParsingError("Dictionaty parsing error"s);
+            }
+        }
     }
-    else if(c == '[')
+
+    void ParseNumber()
     {
-        return LoadArray(input);
+        size_t begin = pos_;
+        while(true)
+        {
+            while(pos_ != data_.size() && IsNumberChar(data_[pos_]))
+            {
+                ++pos_;
+            }
+            if(pos_ != data_.size() || !Refill(begin))
+            {
+                break;
+            }
+            begin = 0;
+        }
+
+        const Node number = json::ParseNumber(data_.data() + begin, data_.data() + pos_);
+        if(number.IsInt())
+        {
+            handler_.OnInt(number.AsInt());
+        }
+        else
+        {
+            handler_.OnDouble(number.AsDouble());
+        }
     }
-    else if(c == '{')
+
+    // Открывающая кавычка уже пропущена. Строка без экранирования отдаётся прямо из буфера
+    std::string_view ParseString()
     {
-        return LoadDict(input);
+        size_t begin = pos_;
+        while(true)
+        {
+            while(pos_ != data_.size() && data_[pos_] != '"' && data_[pos_] != '\\')
+            {
+                ++pos_;
+            }
+            if(pos_ != data_.size())
+            {
+                break;
+            }
+            if(!Refill(begin))
+            {
+                throw ParsingError("String parsing error"s);
+            }
+            begin = 0;
+        }
+
+        if(data_[pos_] == '"')
+        {
+            ++pos_;
+            return data_.substr(begin, pos_ - 1 - begin);
+        }
+
+        // Медленный путь: в строке есть экранированные символы
+        scratch_.assign(data_.data() + begin, pos_ - begin);
+        while(true)
+        {
+            if(pos_ == data_.size() && !Refill(pos_))
+            {
+                throw ParsingError("String parsing error"s);
+            }
+
+            const char c = data_[pos_++];
+            if(c == '"')
+            {
+                return scratch_;
+            }
+            if(c != '\\')
+            {
+                scratch_.push_back(c);
+                continue;
+            }
+
+            if(pos_ == data_.size() && !Refill(pos_))
+            {
+                throw ParsingError("String parsing error"s);
+            }
+            scratch_.push_back(Unescape(data_[pos_++]));
+        }
     }
-    else
+
+    void ExpectWord(std::string_view word, const std::string& error)
     {
-        throw json::ParsingError("Parsing error"s);
+        while(data_.size() - pos_ < word.size())
+        {
+            if(!Refill(pos_))
+            {
+                throw ParsingError(error);
+            }
+        }
+        if(data_.substr(pos_, word.size()) != word)
+        {
+            throw ParsingError(error);
+        }
+
+        pos_ += word.size();
     }
-}
+
+    std::istream* input_;
+    Handler& handler_;
+    std::string buffer_;
+    std::string_view data_;
+    size_t pos_ = 0;
+    std::string scratch_;
+};
+
+} // namespace
 
 Node::Node(int value) : value_(value)
 {
@@ -455,7 +816,30 @@ bool Document::operator!=(const Document& rhs) const
 
 Document Load(std::istream& input)
 {
-    return Document{LoadNode(input)};
+    // Вход читается целиком большими блоками и разбирается уже из памяти
+    string buffer;
+    char block[1 << 16];
+    while(input.read(block, sizeof(block)) || input.gcount() > 0)
+    {
+        buffer.append(block, input.gcount());
+    }
+
+    return Load(std::string_view(buffer));
+}
+
+Document Load(std::string_view input)
+{
+    return Document{Parser(input).LoadNode()};
+}
+
+void Parse(std::istream& input, Handler& handler)
+{
+    EventParser(input, handler).ParseValue();
+}
+
+void Parse(std::string_view input, Handler& handler)
+{
+    EventParser(input, handler).ParseValue();
 }
 
 void Print(const Document& doc, std::ostream& output)
@@ -560,4 +944,148 @@ void Print(const Document& doc, std::ostream& output)
     }
 }
 
+StreamWriter::StreamWriter(std::ostream& output) : output_(output)
+{
+}
+
+StreamWriter& StreamWriter::BeginObject()
+{
+    BeforeValue();
+    output_ << '{';
+    has_items_.push_back(false);
+    return *this;
+}
+
+StreamWriter& StreamWriter::EndObject()
+{
+    has_items_.pop_back();
+    output_ << '}';
+    return *this;
+}
+
+StreamWriter& StreamWriter::BeginArray()
+{
+    BeforeValue();
+    output_ << '[';
+    has_items_.push_back(false);
+    return *this;
+}
+
+StreamWriter& StreamWriter::EndArray()
+{
+    has_items_.pop_back();
+    output_ << ']';
+    return *this;
+}
+
+StreamWriter& StreamWriter::Key(std::string_view key)
+{
+    BeforeValue();
+    WriteString(key);
+    output_ << ": "sv;
+    after_key_ = true;
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(std::nullptr_t)
+{
+    BeforeValue();
+    output_ << "null"sv;
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(bool value)
+{
+    BeforeValue();
+    output_ << (value ? "true"sv : "false"sv);
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(int value)
+{
+    BeforeValue();
+    output_ << value;
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(double value)
+{
+    BeforeValue();
+    output_ << value;
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(std::string_view value)
+{
+    BeforeValue();
+    WriteString(value);
+    return *this;
+}
+
+StreamWriter& StreamWriter::Value(const char* value)
+{
+    return Value(std::string_view(value));
+}
+
+StreamWriter& StreamWriter::RawValue(std::string_view json)
+{
+    BeforeValue();
+    output_ << json;
+    return *this;
+}
+
+// Запятая ставится перед каждым элементом, кроме первого; значение после ключа идёт без неё
+void StreamWriter::BeforeValue()
+{
+    if(after_key_)
+    {
+        after_key_ = false;
+        return;
+    }
+    if(has_items_.empty())
+    {
+        return;
+    }
+
+    if(has_items_.back())
+    {
+        output_ << ", "sv;
+    }
+    has_items_.back() = true;
+}
+
+// Экранирование как в Print; куски без специальных символов пишутся целиком
+void StreamWriter::WriteString(std::string_view str)
+{
+    output_ << '"';
+    size_t begin = 0;
+    for(size_t i = 0; i < str.size(); ++i)
+    {
+        std::string_view escaped;
+        switch(str[i])
+        {
+            case '\\':
+                escaped = "\\\\"sv;
+                break;
+            case '"':
+                escaped = "\\\""sv;
+                break;
+            case '\n':
+                escaped = "\\n"sv;
+                break;
+            case '\r':
+                escaped = "\\r"sv;
+                break;
+            default:
+                continue;
+        }
+
+        output_.write(str.data() + begin, i - begin);
+        output_ << escaped;
+        begin = i + 1;
+    }
+    output_.write(str.data() + begin, str.size() - begin);
+    output_ << '"';
+}
+
 }  // namespace json
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
 
@@ -91,7 +92,64 @@ private:
 };
 
 Document Load(std::istream& input);
+Document Load(std::string_view input);
+
+// Получатель событий потокового разбора: значения приходят по мере чтения текста, дерево Node не строится.
+// Строки, переданные в OnKey и OnString, действительны только на время вызова
+class Handler
+{
+public:
+    virtual ~Handler() = default;
+
+    virtual void OnNull() = 0;
+    virtual void OnBool(bool value) = 0;
+    virtual void OnInt(int value) = 0;
+    virtual void OnDouble(double value) = 0;
+    virtual void OnString(std::string_view value) = 0;
+    virtual void OnKey(std::string_view key) = 0;
+
+    virtual void StartDict() = 0;
+    virtual void EndDict() = 0;
+    virtual void StartArray() = 0;
+    virtual void EndArray() = 0;
+};
+
+// Поток читается блоками, в памяти держится только текущий блок и незаконченное значение
+void Parse(std::istream& input, Handler& handler);
+void Parse(std::string_view input, Handler& handler);
 
 void Print(const Document& doc, std::ostream& output);
 
+// Пишет JSON прямо в поток, не собирая дерево, в том же виде, что и Print.
+// Print выводит ключи словаря по алфавиту, а StreamWriter - в порядке вызовов Key
+class StreamWriter
+{
+public:
+    explicit StreamWriter(std::ostream& output);
+
+    StreamWriter& BeginObject();
+    StreamWriter& EndObject();
+    StreamWriter& BeginArray();
+    StreamWriter& EndArray();
+    StreamWriter& Key(std::string_view key);
+
+    StreamWriter& Value(std::nullptr_t);
+    StreamWriter& Value(bool value);
+    StreamWriter& Value(int value);
+    StreamWriter& Value(double value);
+    StreamWriter& Value(std::string_view value);
+    StreamWriter& Value(const char* value);
+    // Значение, уже записанное в JSON другим StreamWriter
+    StreamWriter& RawValue(std::string_view json);
+
+private:
+    void BeforeValue();
+    void WriteString(std::string_view str);
+
+    std::ostream& output_;
+    // Для каждого открытого массива и словаря: был ли в нём уже элемент
+    std::vector<bool> has_items_;
+    bool after_key_ = false;
+};
+
 }  // namespace json
@@ -1,84 +1,611 @@
 #include "json_reader.h"
 #include "json_builder.h"
+#include "flat_serialization.h"
+#include "server.h"
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace transport::request {
 
-JsonReader::JsonReader(RequestHandler& request_handler,
-                       transport::Catalogue& transport_catalogue,
-                       transport::renderer::MapRenderer& map_renderer,
-                       route::TransportRouter& transport_router)
-    : request_handler_(request_handler), transport_catalogue_(transport_catalogue), map_renderer_(map_renderer), transport_router_(transport_router)
+namespace {
+
+// Формат файла базы: protobuf (по умолчанию) или плоский, отображаемый в память
+bool IsFlatBaseFormat(const json::Dict& json_serialization_settings)
 {
+    if(json_serialization_settings.count("format"s) == 0)
+    {
+        return false;
+    }
+
+    const std::string& format = json_serialization_settings.at("format"s).AsString();
+    if(format == "flat"s)
+    {
+        return true;
+    }
+    if(format != "protobuf"s)
+    {
+        throw std::invalid_argument("Unknown base format: "s + format);
+    }
+
+    return false;
 }
 
-void JsonReader::ExecMakeBase(std::istream& in)
+// Число потоков из настроек запуска: по умолчанию один, 0 - по числу ядер
+size_t GetThreadCount(const json::Dict& json_process_settings)
 {
-    const json::Document json_document = json::Load(in);
-    const json::Node& json_root = json_document.GetRoot();
-    const json::Dict& dictionary = json_root.AsDict();
+    if(json_process_settings.count("thread_count"s) == 0)
+    {
+        return 1;
+    }
 
-    if(dictionary.count("routing_settings"s) != 0)
+    const int thread_count = json_process_settings.at("thread_count"s).AsInt();
+    if(thread_count < 0)
     {
-        const json::Dict& json_routing_settings = dictionary.at("routing_settings"s).AsDict();
-        request_handler_.SetRoutingSettings(GetRoutingSettings(json_routing_settings));
+        throw std::invalid_argument("Thread count should be non-negative");
+    }
+    if(thread_count == 0)
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
     }
 
-    if(dictionary.count("render_settings"s) != 0)
+    return thread_count;
+}
+
+// Столько запросов подряд берёт поток за раз
+const size_t REQUEST_CHUNK_SIZE = 64;
+
+// Справочник, маршрутизатор и карта, загруженные из одного файла базы. После загрузки они только читаются,
+// поэтому сервер при перезагрузке заменяет снимок целиком
+struct BaseSnapshot
+{
+    BaseSnapshot() : request_handler(transport_catalogue, transport_router, map_renderer),
+                     json_reader(request_handler, transport_catalogue, map_renderer, transport_router)
     {
-        const json::Dict& json_render_settings = dictionary.at("render_settings"s).AsDict();
-        request_handler_.SetRendererSettings(GetRenderSettings(json_render_settings));
     }
 
-    if(dictionary.count("base_requests"s) != 0)
+    transport::Catalogue transport_catalogue;
+    route::TransportRouter transport_router;
+    transport::renderer::MapRenderer map_renderer;
+    RequestHandler request_handler;
+    JsonReader json_reader;
+};
+
+// Старые снимки освобождаются на потоке перезагрузки: последний владелец снимка, обычно рабочий поток,
+// только передаёт его сюда, чтобы не разбирать его память посреди обработки запросов
+class SnapshotReleaser
+{
+public:
+    SnapshotReleaser() = default;
+    SnapshotReleaser(const SnapshotReleaser&) = delete;
+    SnapshotReleaser& operator=(const SnapshotReleaser&) = delete;
+
+    // Снимки, отпущенные после остановки сервера, освобождаются здесь
+    ~SnapshotReleaser()
     {
-        std::map<std::string, json::Dict> distances;
+        for(BaseSnapshot* snapshot : released_)
+        {
+            delete snapshot;
+        }
+    }
 
-        const auto& json_base_requests = dictionary.at("base_requests"s).AsArray();
+    std::shared_ptr<BaseSnapshot> Own(std::unique_ptr<BaseSnapshot> snapshot)
+    {
+        return std::shared_ptr<BaseSnapshot>(snapshot.release(), [this](BaseSnapshot* released)
+        {
+            {
+                std::lock_guard guard(mutex_);
+                released_.push_back(released);
+            }
+            snapshot_released_.notify_all();
+        });
+    }
+
+    // Ждёт, пока снимок отпустят начатые на нём запросы, и освобождает его вместе с уже отпущенными
+    void Release(std::shared_ptr<BaseSnapshot> snapshot)
+    {
+        const BaseSnapshot* expected = snapshot.get();
+        snapshot.reset();
 
-        for(const auto& json_base_request : json_base_requests)
+        std::vector<BaseSnapshot*> released;
         {
-            std::string type = json_base_request.AsDict().at("type"s).AsString();
-            if(type == "Stop"s)
+            std::unique_lock lock(mutex_);
+            snapshot_released_.wait(lock, [this, expected]
             {
-                double lat = json_base_request.AsDict().at("latitude"s).AsDouble();
-                double lng = json_base_request.AsDict().at("longitude"s).AsDouble();
-                std::string name = json_base_request.AsDict().at("name"s).AsString();
+                return std::find(released_.begin(), released_.end(), expected) != released_.end();
+            });
+            released.swap(released_);
+        }
 
-                request_handler_.AddStop(name, lat, lng);
+        for(BaseSnapshot* released_snapshot : released)
+        {
+            delete released_snapshot;
+        }
+    }
 
-                distances[name] = json_base_request.AsDict().at("road_distances"s).AsDict();
-            }
+private:
+    std::mutex mutex_;
+    std::condition_variable snapshot_released_;
+    std::vector<BaseSnapshot*> released_;
+};
+
+// Разбирает make_base по событиям парсера, не строя дерево документа. Остановки добавляются в справочник
+// сразу, расстояния и маршруты копятся до конца base_requests, потому что могут ссылаться на остановки ниже по тексту.
+// Настройки небольшие, они собираются в узлы целиком
+class MakeBaseHandler : public json::Handler
+{
+public:
+    explicit MakeBaseHandler(RequestHandler& request_handler) : request_handler_(request_handler)
+    {
+    }
+
+    void OnNull() override
+    {
+        OnValue(json::Node{nullptr});
+    }
+
+    void OnBool(bool value) override
+    {
+        OnValue(json::Node{value});
+    }
+
+    void OnInt(int value) override
+    {
+        OnValue(json::Node{value});
+    }
+
+    void OnDouble(double value) override
+    {
+        OnValue(json::Node{value});
+    }
+
+    void OnString(std::string_view value) override
+    {
+        OnValue(json::Node{std::string(value)});
+    }
+
+    void OnKey(std::string_view key) override
+    {
+        if(skip_depth_)
+        {
+            return;
+        }
+        if(settings_builder_)
+        {
+            settings_builder_->Key(std::string(key));
+            return;
         }
 
-        for(auto& distance : distances)
+        if(depth_ == ROOT_DEPTH)
         {
-            for(auto [stop, dist] : distance.second)
-            {
-                request_handler_.AddDistance(distance.first, stop, dist.AsInt());
-            }
+            root_key_ = key;
+        }
+        else if(depth_ == REQUEST_DEPTH)
+        {
+            request_key_ = key;
+        }
+        else
+        {
+            distance_stop_ = key;
+        }
+    }
+
+    void StartDict() override
+    {
+        StartContainer(true);
+    }
+
+    void EndDict() override
+    {
+        EndContainer(true);
+    }
+
+    void StartArray() override
+    {
+        StartContainer(false);
+    }
+
+    void EndArray() override
+    {
+        EndContainer(false);
+    }
+
+    // Настройки из корня документа: routing_settings, render_settings и serialization_settings
+    const json::Dict& GetSettings() const
+    {
+        return settings_;
+    }
+
+    bool HasBaseRequests() const
+    {
+        return has_base_requests_;
+    }
+
+    // Добавляет накопленные расстояния и маршруты, когда известны все остановки
+    void Finish()
+    {
+        for(const auto& distance : distances_)
+        {
+            request_handler_.AddDistance(distance.from, GetStopId(distance.to), distance.distance);
         }
+        distances_.clear();
 
-        for(const auto& json_base_request : json_base_requests)
+        for(const auto& bus : buses_)
         {
-            std::string type = json_base_request.AsDict().at("type"s).AsString();
-            if(type == "Bus"s)
-            {
-                auto& json_route = json_base_request.AsDict();
+            request_handler_.AddBus(bus.name, bus.stops, bus.is_roundtrip);
+        }
+        buses_.clear();
+    }
+
+private:
+    static constexpr size_t ROOT_DEPTH = 1;
+    static constexpr size_t BASE_REQUESTS_DEPTH = 2;
+    static constexpr size_t REQUEST_DEPTH = 3;
+    static constexpr size_t REQUEST_FIELD_DEPTH = 4;
 
-                std::vector<std::string> stops;
-                for(auto& stop : json_route.at("stops"s).AsArray())
+    // Поля текущего запроса; буферы переиспользуются от запроса к запросу
+    struct BaseRequest
+    {
+        void Clear()
+        {
+            type.reset();
+            name.reset();
+            latitude.reset();
+            longitude.reset();
+            is_roundtrip.reset();
+            has_road_distances = false;
+            has_stops = false;
+            road_distances.clear();
+            stops.clear();
+        }
+
+        std::optional<std::string> type;
+        std::optional<std::string> name;
+        std::optional<double> latitude;
+        std::optional<double> longitude;
+        std::optional<bool> is_roundtrip;
+        bool has_road_distances = false;
+        bool has_stops = false;
+        std::vector<std::pair<std::string, int>> road_distances;
+        std::vector<std::string> stops;
+    };
+
+    struct PendingDistance
+    {
+        domain::StopId from;
+        std::string to;
+        int distance;
+    };
+
+    struct PendingBus
+    {
+        std::string name;
+        std::vector<std::string> stops;
+        bool is_roundtrip;
+    };
+
+    static bool IsSettingsKey(std::string_view key)
+    {
+        return key == "routing_settings"sv || key == "render_settings"sv || key == "serialization_settings"sv;
+    }
+
+    template <typename Value>
+    static const Value& GetField(const std::optional<Value>& field, const std::string& key)
+    {
+        if(!field)
+        {
+            throw std::out_of_range("Base request has no field "s + key);
+        }
+
+        return *field;
+    }
+
+    domain::StopId GetStopId(std::string_view name) const
+    {
+        const domain::Stop* stop = request_handler_.FindStop(name);
+        if(stop == nullptr)
+        {
+            throw std::invalid_argument("Unknown stop: "s + std::string(name));
+        }
+
+        return stop->id_;
+    }
+
+    void OnValue(json::Node value)
+    {
+        if(skip_depth_)
+        {
+            return;
+        }
+        if(settings_builder_)
+        {
+            settings_builder_->Value(value);
+            return;
+        }
+
+        switch(depth_)
+        {
+            case 0:
+                value.AsDict();
+                break;
+            case ROOT_DEPTH:
+                if(root_key_ == "base_requests"sv)
+                {
+                    value.AsArray();
+                }
+                if(IsSettingsKey(root_key_))
+                {
+                    settings_[root_key_] = std::move(value);
+                }
+                break;
+            case BASE_REQUESTS_DEPTH:
+                value.AsDict();
+                break;
+            case REQUEST_DEPTH:
+                SetRequestField(value);
+                break;
+            default:
+                if(request_key_ == "stops"sv)
+                {
+                    request_.stops.push_back(value.AsString());
+                }
+                else
+                {
+                    request_.road_distances.emplace_back(distance_stop_, value.AsInt());
+                }
+        }
+    }
+
+    void SetRequestField(const json::Node& value)
+    {
+        if(request_key_ == "type"sv)
+        {
+            request_.type = value.AsString();
+        }
+        else if(request_key_ == "name"sv)
+        {
+            request_.name = value.AsString();
+        }
+        else if(request_key_ == "latitude"sv)
+        {
+            request_.latitude = value.AsDouble();
+        }
+        else if(request_key_ == "longitude"sv)
+        {
+            request_.longitude = value.AsDouble();
+        }
+        else if(request_key_ == "is_roundtrip"sv)
+        {
+            request_.is_roundtrip = value.AsBool();
+        }
+        else if(request_key_ == "road_distances"sv)
+        {
+            value.AsDict();
+        }
+        else if(request_key_ == "stops"sv)
+        {
+            value.AsArray();
+        }
+    }
+
+    // Те же ошибки, что и у json::Node::AsDict и AsArray при разборе через дерево
+    static void CheckContainer(bool is_dict, bool should_be_dict)
+    {
+        if(is_dict != should_be_dict)
+        {
+            throw std::logic_error(should_be_dict ? "The value is not dictionary" : "The value is not array");
+        }
+    }
+
+    void StartSettingsContainer(bool is_dict)
+    {
+        if(is_dict)
+        {
+            settings_builder_->StartDict();
+        }
+        else
+        {
+            settings_builder_->StartArray();
+        }
+    }
+
+    void StartContainer(bool is_dict)
+    {
+        if(skip_depth_)
+        {
+            ++depth_;
+            return;
+        }
+        if(settings_builder_)
+        {
+            StartSettingsContainer(is_dict);
+            ++depth_;
+            return;
+        }
+
+        switch(depth_)
+        {
+            case 0:
+                CheckContainer(is_dict, true);
+                break;
+            case ROOT_DEPTH:
+                if(root_key_ == "base_requests"sv)
+                {
+                    CheckContainer(is_dict, false);
+                    has_base_requests_ = true;
+                }
+                else if(IsSettingsKey(root_key_))
+                {
+                    settings_builder_.emplace();
+                    StartSettingsContainer(is_dict);
+                }
+                else
+                {
+                    skip_depth_ = depth_;
+                }
+                break;
+            case BASE_REQUESTS_DEPTH:
+                CheckContainer(is_dict, true);
+                request_.Clear();
+                break;
+            case REQUEST_DEPTH:
+                if(request_key_ == "road_distances"sv)
+                {
+                    CheckContainer(is_dict, true);
+                    request_.has_road_distances = true;
+                    request_.road_distances.clear();
+                }
+                else if(request_key_ == "stops"sv)
+                {
+                    CheckContainer(is_dict, false);
+                    request_.has_stops = true;
+                    request_.stops.clear();
+                }
+                else
                 {
-                    stops.push_back(stop.AsString());
+                    SetRequestField(is_dict ? json::Node{json::Dict{}} : json::Node{json::Array{}});
+                    skip_depth_ = depth_;
                 }
+                break;
+            default:
+                // Внутри stops и road_distances ждём только строки и числа
+                throw std::logic_error(request_key_ == "stops"sv ? "The value is not string" : "The value is not int");
+        }
+
+        ++depth_;
+    }
+
+    void EndContainer(bool is_dict)
+    {
+        --depth_;
+
+        if(skip_depth_)
+        {
+            if(*skip_depth_ == depth_)
+            {
+                skip_depth_.reset();
+            }
+            return;
+        }
+        if(settings_builder_)
+        {
+            if(is_dict)
+            {
+                settings_builder_->EndDict();
+            }
+            else
+            {
+                settings_builder_->EndArray();
+            }
+            if(depth_ == ROOT_DEPTH)
+            {
+                settings_[root_key_] = settings_builder_->Build();
+                settings_builder_.reset();
+            }
+            return;
+        }
+
+        if(depth_ == BASE_REQUESTS_DEPTH)
+        {
+            FinishRequest();
+        }
+    }
+
+    void FinishRequest()
+    {
+        if(!request_.type)
+        {
+            throw std::out_of_range("Base request has no field type"s);
+        }
 
-                bool is_roundtrip = json_route.at("is_roundtrip"s).AsBool();
-                std::string name = json_route.at("name"s).AsString();
+        if(*request_.type == "Stop"s)
+        {
+            const std::string& name = GetField(request_.name, "name"s);
+            request_handler_.AddStop(name, GetField(request_.latitude, "latitude"s), GetField(request_.longitude, "longitude"s));
+            if(!request_.has_road_distances)
+            {
+                throw std::out_of_range("Base request has no field road_distances"s);
+            }
 
-                request_handler_.AddBus(name, stops, is_roundtrip);
+            const domain::StopId from = GetStopId(name);
+            for(auto& [to, distance] : request_.road_distances)
+            {
+                distances_.push_back({from, std::move(to), distance});
+            }
+        }
+        else if(*request_.type == "Bus"s)
+        {
+            if(!request_.has_stops)
+            {
+                throw std::out_of_range("Base request has no field stops"s);
             }
+            const bool is_roundtrip = GetField(request_.is_roundtrip, "is_roundtrip"s);
+            buses_.push_back({GetField(request_.name, "name"s), request_.stops, is_roundtrip});
         }
+    }
+
+    RequestHandler& request_handler_;
+
+    size_t depth_ = 0;
+    // Глубина, на которой начался пропускаемый контейнер
+    std::optional<size_t> skip_depth_;
+    std::optional<json::Builder> settings_builder_;
+
+    std::string root_key_;
+    std::string request_key_;
+    std::string distance_stop_;
+
+    json::Dict settings_;
+    bool has_base_requests_ = false;
+
+    BaseRequest request_;
+    std::vector<PendingDistance> distances_;
+    std::vector<PendingBus> buses_;
+};
+
+} // namespace
+
+JsonReader::JsonReader(RequestHandler& request_handler,
+                       transport::Catalogue& transport_catalogue,
+                       transport::renderer::MapRenderer& map_renderer,
+                       route::TransportRouter& transport_router)
+    : request_handler_(request_handler), transport_catalogue_(transport_catalogue), map_renderer_(map_renderer), transport_router_(transport_router)
+{
+}
+
+void JsonReader::ExecMakeBase(std::istream& in)
+{
+    // base_requests разбираются прямо при чтении: остановки попадают в справочник без промежуточного дерева
+    MakeBaseHandler handler(request_handler_);
+    json::Parse(in, handler);
+    const json::Dict& dictionary = handler.GetSettings();
+
+    if(dictionary.count("routing_settings"s) != 0)
+    {
+        const json::Dict& json_routing_settings = dictionary.at("routing_settings"s).AsDict();
+        request_handler_.SetRoutingSettings(GetRoutingSettings(json_routing_settings));
+    }
+
+    if(dictionary.count("render_settings"s) != 0)
+    {
+        const json::Dict& json_render_settings = dictionary.at("render_settings"s).AsDict();
+        request_handler_.SetRendererSettings(GetRenderSettings(json_render_settings));
+    }
+
+    if(handler.HasBaseRequests())
+    {
+        handler.Finish();
+
+        request_handler_.BuildStopIndex();
 
         for(const auto& stop : request_handler_.GetStops())
         {
@@ -93,11 +620,10 @@ void JsonReader::ExecMakeBase(std::istream& in)
             for(size_t i = 0; i < stops.size() - 1; ++i)
             {
                 int full_distance = 0;
-                std::string prev_stop_name = stops[i]->name_;
 
                 for(size_t j = i + 1; j < stops.size(); ++j)
                 {
-                    double distance = request_handler_.GetDistance(prev_stop_name, stops[j]->name_);
+                    double distance = request_handler_.GetDistance(stops[j - 1]->id_, stops[j]->id_);
 
                     request_handler_.AddBusEdgeToRouter(stops[i]->name_,
                                                         stops[j]->name_,
@@ -105,7 +631,6 @@ void JsonReader::ExecMakeBase(std::istream& in)
                                                         j - i,
                                                         full_distance + distance);
 
-                    prev_stop_name = stops[j]->name_;
                     full_distance += distance;
                 }
             }
@@ -119,8 +644,22 @@ void JsonReader::ExecMakeBase(std::istream& in)
         const json::Dict& json_serialization_settings = dictionary.at("serialization_settings"s).AsDict();
         std::string file = json_serialization_settings.at("file").AsString();
 
-        proto::Serializer serializer(transport_catalogue_, map_renderer_, transport_router_);
-        serializer(file);
+        // Карту можно нарисовать сразу и положить в базу, тогда process_requests её не рисует
+        if(json_serialization_settings.count("store_map"s) != 0 && json_serialization_settings.at("store_map"s).AsBool())
+        {
+            request_handler_.GetMap();
+        }
+
+        if(IsFlatBaseFormat(json_serialization_settings))
+        {
+            flat::Serializer serializer(transport_catalogue_, map_renderer_, transport_router_);
+            serializer(file);
+        }
+        else
+        {
+            proto::Serializer serializer(transport_catalogue_, map_renderer_, transport_router_);
+            serializer(file);
+        }
     }
 }
 
@@ -130,15 +669,12 @@ void JsonReader::ExecProcessRequest(std::istream& in, std::ostream& out)
     const json::Node& json_root = json_document.GetRoot();
     const json::Dict& dictionary = json_root.AsDict();
 
-    if(dictionary.count("serialization_settings"s) != 0)
-    {
-        const json::Dict& json_serialization_settings = dictionary.at("serialization_settings"s).AsDict();
-        std::string file = json_serialization_settings.at("file").AsString();
-
-        //serialization::Deserialization(file, catalogue_, map_renderer_, transport_router_);
+    LoadBase(dictionary);
 
-        proto::Deserializer deserializer(transport_catalogue_, map_renderer_, transport_router_);
-        deserializer(file);
+    size_t thread_count = 1;
+    if(dictionary.count("process_settings"s) != 0)
+    {
+        thread_count = GetThreadCount(dictionary.at("process_settings"s).AsDict());
     }
 
     if(dictionary.count("stat_requests"s) != 0)
@@ -147,117 +683,394 @@ void JsonReader::ExecProcessRequest(std::istream& in, std::ostream& out)
 
         if(!json_stat_requests.empty())
         {
-            RequestsProcessing(json_stat_requests, out);
+            RequestsProcessing(json_stat_requests, out, thread_count);
         }
     }
 }
 
-void JsonReader::RequestsProcessing(const json::Array& json_stat_requests, std::ostream& out)
+void JsonReader::ExecStreamRequests(std::istream& in, std::ostream& out)
+{
+    std::string line;
+    if(!std::getline(in, line))
+    {
+        return;
+    }
+    LoadBase(json::Load(std::string_view(line)).GetRoot().AsDict());
+
+    while(std::getline(in, line))
+    {
+        if(std::all_of(line.begin(), line.end(), [](unsigned char c) { return std::isspace(c); }))
+        {
+            continue;
+        }
+
+        ProcessRequestLine(line, out);
+        out << '\n';
+        out.flush();
+    }
+}
+
+void JsonReader::ExecServe(std::istream& in)
+{
+    const json::Document json_document = json::Load(in);
+    const json::Dict& dictionary = json_document.GetRoot().AsDict();
+
+    // Объявлен раньше снимка, чтобы пережить его
+    SnapshotReleaser snapshot_releaser;
+
+    const auto load_snapshot = [&dictionary, &snapshot_releaser]
+    {
+        auto snapshot = std::make_unique<BaseSnapshot>();
+        snapshot->json_reader.LoadBase(dictionary);
+        return snapshot_releaser.Own(std::move(snapshot));
+    };
+
+    // Текущий снимок подменяется целиком, запрос выполняется на том снимке, который взял в начале
+    std::shared_ptr<BaseSnapshot> snapshot = load_snapshot();
+
+    const json::Dict& json_server_settings = dictionary.at("server_settings"s).AsDict();
+    server::Server server(json_server_settings.at("socket"s).AsString(),
+                          GetThreadCount(json_server_settings),
+                          [&snapshot](std::string_view request)
+                          {
+                              const std::shared_ptr<BaseSnapshot> current = std::atomic_load(&snapshot);
+                              std::ostringstream response;
+                              current->json_reader.ProcessRequestLine(request, response);
+                              return response.str();
+                          },
+                          [&snapshot, &load_snapshot, &snapshot_releaser]
+                          {
+                              try
+                              {
+                                  snapshot_releaser.Release(std::atomic_exchange(&snapshot, load_snapshot()));
+
+                                  std::cerr << "Base reloaded\n"sv;
+                              }
+                              catch(const std::exception& error)
+                              {
+                                  // Сервер продолжает работать на прежней базе
+                                  std::cerr << "Base reload failed: "sv << error.what() << '\n';
+                              }
+                          });
+    server.Run();
+}
+
+// Ошибка в одном запросе не останавливает обработку остальных: вместо ответа выводится error_message
+void JsonReader::ProcessRequestLine(std::string_view line, std::ostream& out)
+{
+    json::StreamWriter writer(out);
+    try
+    {
+        const json::Document json_document = json::Load(line);
+        ProcessRequest(json_document.GetRoot().AsDict(), writer);
+    }
+    catch(const std::exception& error)
+    {
+        writer.BeginObject()
+                  .Key("error_message"sv).Value(error.what())
+              .EndObject();
+    }
+}
+
+void JsonReader::LoadBase(const json::Dict& dictionary)
 {
-    json::Builder json_responses;
-    json_responses.StartArray();
+    if(dictionary.count("serialization_settings"s) == 0)
+    {
+        return;
+    }
+
+    const json::Dict& json_serialization_settings = dictionary.at("serialization_settings"s).AsDict();
+    std::string file = json_serialization_settings.at("file").AsString();
 
-    for(const auto& stat_request : json_stat_requests)
+    if(IsFlatBaseFormat(json_serialization_settings))
     {
-        auto stat_request_map = stat_request.AsDict();
-        int id = stat_request_map.at("id"s).AsInt();
-        const std::string& type = stat_request_map.at("type"s).AsString();
+        flat::Deserializer deserializer(transport_catalogue_, map_renderer_, transport_router_);
+        deserializer(file);
+    }
+    else
+    {
+        proto::Deserializer deserializer(transport_catalogue_, map_renderer_, transport_router_);
+        deserializer(file);
+    }
+}
 
-        json::Builder json_response;
-        json_response.StartDict().Key("request_id"s).Value(json::Node(id));
+void JsonReader::RequestsProcessing(const json::Array& json_stat_requests, std::ostream& out, size_t thread_count)
+{
+    const size_t request_count = json_stat_requests.size();
 
-        if(type == "Stop"s)
+    const size_t chunk_count = (request_count + REQUEST_CHUNK_SIZE - 1) / REQUEST_CHUNK_SIZE;
+    thread_count = std::max<size_t>(1, std::min(thread_count, chunk_count));
+
+    // Каждый ответ выводится сразу, как только готов, без промежуточного дерева
+    json::StreamWriter writer(out);
+    writer.BeginArray();
+
+    if(thread_count == 1)
+    {
+        for(const auto& json_stat_request : json_stat_requests)
         {
-            const std::string& stop_name = stat_request_map.at("name"s).AsString();
+            ProcessRequest(json_stat_request.AsDict(), writer);
+        }
+    }
+    else
+    {
+        // Потоки пишут ответы своей пачки в строки, а этот поток выводит готовые пачки по порядку и освобождает их.
+        // Пачки раздаются по возрастанию номеров, и после ошибки поток дорабатывает уже взятые пачки,
+        // поэтому все запросы до первого ошибочного выводятся и выбрасывается та же ошибка, что и без потоков
+        struct Chunk
+        {
+            std::vector<std::string> responses;
+            std::exception_ptr error;
+            bool is_ready = false;
+        };
 
-            auto buses = request_handler_.GetStopInfo(stop_name);
-            if(!buses.buses_.empty() || buses.is_exist_)
-            {
-                json_response.Key("buses"s).StartArray();
+        std::vector<Chunk> chunks(chunk_count);
+        std::mutex chunks_mutex;
+        std::condition_variable chunk_ready;
+        std::atomic<size_t> next_chunk = 0;
+        std::atomic<bool> is_failed = false;
 
-                for(const auto bus: buses.buses_)
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for(size_t thread_id = 0; thread_id < thread_count; ++thread_id)
+        {
+            threads.emplace_back([&] {
+                while(!is_failed)
                 {
-                    json_response.Value(json::Node{static_cast<std::string>(bus)});
+                    const size_t chunk_id = next_chunk.fetch_add(1);
+                    if(chunk_id >= chunk_count)
+                    {
+                        break;
+                    }
+
+                    Chunk& chunk = chunks[chunk_id];
+                    const size_t begin = chunk_id * REQUEST_CHUNK_SIZE;
+                    const size_t end = std::min(begin + REQUEST_CHUNK_SIZE, request_count);
+                    for(size_t i = begin; i < end; ++i)
+                    {
+                        try
+                        {
+                            std::ostringstream response;
+                            response.copyfmt(out);
+                            json::StreamWriter response_writer(response);
+                            ProcessRequest(json_stat_requests[i].AsDict(), response_writer);
+                            chunk.responses.push_back(response.str());
+                        }
+                        catch(...)
+                        {
+                            chunk.error = std::current_exception();
+                            is_failed = true;
+                            break;
+                        }
+                    }
+
+                    {
+                        std::lock_guard guard(chunks_mutex);
+                        chunk.is_ready = true;
+                    }
+                    chunk_ready.notify_all();
                 }
+            });
+        }
 
-                json_response.EndArray();
+        std::exception_ptr error;
+        for(Chunk& chunk : chunks)
+        {
+            {
+                std::unique_lock lock(chunks_mutex);
+                chunk_ready.wait(lock, [&chunk] { return chunk.is_ready; });
             }
-            else
+
+            for(const std::string& response : chunk.responses)
             {
-                json_response.Key("error_message"s).Value("not found"s);
+                writer.RawValue(response);
+            }
+            chunk.responses = {};
+
+            if(chunk.error)
+            {
+                error = chunk.error;
+                break;
             }
         }
-        else if(type == "Bus"s)
+
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    writer.EndArray();
+}
+
+// Ключи пишутся по алфавиту, как их выводил json::Print. Всё, что может выбросить исключение
+// из-за неверного запроса, читается до начала вывода ответа
+void JsonReader::ProcessRequest(const json::Dict& stat_request_map, json::StreamWriter& writer)
+{
+    int id = stat_request_map.at("id"s).AsInt();
+    const std::string& type = stat_request_map.at("type"s).AsString();
+
+    if(type == "Stop"s)
+    {
+        const std::string& stop_name = stat_request_map.at("name"s).AsString();
+
+        auto buses = request_handler_.GetStopInfo(stop_name);
+        writer.BeginObject();
+        if(!buses.buses_.empty() || buses.is_exist_)
         {
-            const std::string& bus_name = stat_request_map.at("name"s).AsString();
+            writer.Key("buses"sv).BeginArray();
 
-            if(request_handler_.FindBus(bus_name) == nullptr)
+            for(const auto bus: buses.buses_)
             {
-                json_response.Key("error_message"s).Value("not found"s);
+                writer.Value(bus);
             }
-            else
-            {
-                auto route = request_handler_.GetBusInfo(bus_name);
 
-                json_response.Key("curvature"s).Value(route.curvature_)
-                             .Key("stop_count"s).Value(static_cast<int>(route.stops_count_))
-                             .Key("unique_stop_count"s).Value(static_cast<int>(route.unique_stops_count_))
-                             .Key("route_length"s).Value(static_cast<double>(route.distance_));
-            }
+            writer.EndArray();
         }
-        else if(type == "Map"s)
+        else
         {
-            std::ostringstream o;
-            svg::Document svg = request_handler_.RenderMap();
-            svg.Render(o);
+            writer.Key("error_message"sv).Value("not found"sv);
+        }
+        writer.Key("request_id"sv).Value(id);
+        writer.EndObject();
+    }
+    else if(type == "Bus"s)
+    {
+        const std::string& bus_name = stat_request_map.at("name"s).AsString();
 
-            json_response.Key("map"s).Value(o.str());
+        const auto route = request_handler_.GetBusInfo(bus_name);
+        writer.BeginObject();
+        if(!route.is_exist_)
+        {
+            writer.Key("error_message"sv).Value("not found"sv)
+                  .Key("request_id"sv).Value(id);
         }
-        else if(type == "Route"s)
+        else
+        {
+            writer.Key("curvature"sv).Value(route.curvature_)
+                  .Key("request_id"sv).Value(id)
+                  .Key("route_length"sv).Value(static_cast<double>(route.distance_))
+                  .Key("stop_count"sv).Value(static_cast<int>(route.stops_count_))
+                  .Key("unique_stop_count"sv).Value(static_cast<int>(route.unique_stops_count_));
+        }
+        writer.EndObject();
+    }
+    else if(type == "Map"s)
+    {
+        writer.BeginObject()
+                  .Key("map"sv).Value(request_handler_.GetMap())
+                  .Key("request_id"sv).Value(id)
+              .EndObject();
+    }
+    else if(type == "Route"s)
+    {
+        const auto get_endpoint = [&stat_request_map](const std::string& key) -> RouteEndpoint
         {
-            const std::string& from = stat_request_map.at("from"s).AsString();
-            const std::string& to = stat_request_map.at("to"s).AsString();
+            const auto point = stat_request_map.find(key + "_point"s);
+            if(point != stat_request_map.end())
+            {
+                const auto& coordinates = point->second.AsDict();
+                return geo::Coordinates{coordinates.at("latitude"s).AsDouble(), coordinates.at("longitude"s).AsDouble()};
+            }
+
+            return std::string_view(stat_request_map.at(key).AsString());
+        };
 
-            auto route_info = request_handler_.GetRouteInfo(from, to);
+        auto route_info = request_handler_.GetRouteInfo(get_endpoint("from"s), get_endpoint("to"s));
 
-            if(route_info)
+        writer.BeginObject();
+        if(route_info)
+        {
+            writer.Key("items"sv).BeginArray();
+            for(const auto& item : route_info->items)
             {
-                json_response.Key("items"s).StartArray();
-                for(const auto& item : route_info->items)
+                writer.BeginObject();
+                if(item.wait_item)
                 {
-                    json_response.StartDict();
-                    if(item.wait_item)
-                    {
-                        json_response.Key("type"s).Value(json::Node{static_cast<std::string>("Wait"s)});
-                        json_response.Key("stop_name"s).Value(json::Node{static_cast<std::string>(item.wait_item->stop_name)});
-                        json_response.Key("time"s).Value(json::Node{static_cast<double>(item.wait_item->time)});
-                    }
-                    else
+                    writer.Key("stop_name"sv).Value(item.wait_item->stop_name)
+                          .Key("time"sv).Value(item.wait_item->time)
+                          .Key("type"sv).Value("Wait"sv);
+                }
+                else if(item.walk_item)
+                {
+                    if(!item.walk_item->stop_name.empty())
                     {
-                        json_response.Key("type"s).Value(json::Node{static_cast<std::string>("Bus"s)});
-                        json_response.Key("bus"s).Value(json::Node{static_cast<std::string>(item.bus_item->bus_name)});
-                        json_response.Key("span_count"s).Value(json::Node{static_cast<int>(item.bus_item->span_count)});
-                        json_response.Key("time"s).Value(json::Node{static_cast<double>(item.bus_item->time)});
+                        writer.Key("stop_name"sv).Value(item.walk_item->stop_name);
                     }
-                    json_response.EndDict();
+                    writer.Key("time"sv).Value(item.walk_item->time)
+                          .Key("type"sv).Value("Walk"sv);
                 }
-                json_response.EndArray();
-
-                json_response.Key("total_time"s).Value(route_info->total_time);
-            }
-            else
-            {
-                json_response.Key("error_message"s).Value("not found"s);
+                else
+                {
+                    writer.Key("bus"sv).Value(item.bus_item->bus_name)
+                          .Key("span_count"sv).Value(static_cast<int>(item.bus_item->span_count))
+                          .Key("time"sv).Value(item.bus_item->time)
+                          .Key("type"sv).Value("Bus"sv);
+                }
+                writer.EndObject();
             }
-        }
+            writer.EndArray();
 
-        json_response.EndDict();
-        json_responses.Value(json_response.Build());
+            writer.Key("request_id"sv).Value(id)
+                  .Key("total_time"sv).Value(route_info->total_time);
+        }
+        else
+        {
+            writer.Key("error_message"sv).Value("not found"sv)
+                  .Key("request_id"sv).Value(id);
+        }
+        writer.EndObject();
     }
+    else if(type == "NearestStops"s)
+    {
+        const geo::Coordinates point = {stat_request_map.at("latitude"s).AsDouble(), stat_request_map.at("longitude"s).AsDouble()};
+        const int count = stat_request_map.at("count"s).AsInt();
+        if(count < 0)
+        {
+            throw std::invalid_argument("Negative stop count in NearestStops request");
+        }
 
-    json_responses.EndArray();
+        writer.BeginObject()
+                  .Key("request_id"sv).Value(id)
+                  .Key("stops"sv).BeginArray();
+        for(const auto& [stop, distance] : request_handler_.FindNearestStops(point, count))
+        {
+            writer.BeginObject()
+                      .Key("distance"sv).Value(distance)
+                      .Key("name"sv).Value(stop->name_)
+                  .EndObject();
+        }
+        writer.EndArray()
+              .EndObject();
+    }
+    else if(type == "StopsInBox"s)
+    {
+        const geo::SpatialIndex::Box box = {stat_request_map.at("min_latitude"s).AsDouble(),
+                                            stat_request_map.at("min_longitude"s).AsDouble(),
+                                            stat_request_map.at("max_latitude"s).AsDouble(),
+                                            stat_request_map.at("max_longitude"s).AsDouble()};
 
-    json::Print(json::Document{json_responses.Build()}, out);
+        writer.BeginObject()
+                  .Key("request_id"sv).Value(id)
+                  .Key("stops"sv).BeginArray();
+        for(const auto* stop : request_handler_.FindStopsInBox(box))
+        {
+            writer.Value(stop->name_);
+        }
+        writer.EndArray()
+              .EndObject();
+    }
+    else
+    {
+        writer.BeginObject()
+                  .Key("request_id"sv).Value(id)
+              .EndObject();
+    }
 }
 
 svg::Color JsonReader::ReadColor(const json::Node& json_color)
@@ -322,6 +1135,59 @@ route::Settings JsonReader::GetRoutingSettings(const json::Dict& json_routing_se
     routing_settings.bus_wait_time = json_routing_settings.at("bus_wait_time").AsInt();
     routing_settings.bus_velocity = json_routing_settings.at("bus_velocity").AsDouble();
 
+    if(json_routing_settings.count("router_type"s) != 0)
+    {
+        const std::string& router_type = json_routing_settings.at("router_type"s).AsString();
+        if(router_type == "all_pairs"s)
+        {
+            routing_settings.router_type = route::RouterType::ALL_PAIRS;
+        }
+        else if(router_type == "dijkstra"s)
+        {
+            routing_settings.router_type = route::RouterType::DIJKSTRA;
+        }
+        else if(router_type == "contraction_hierarchies"s)
+        {
+            routing_settings.router_type = route::RouterType::CONTRACTION_HIERARCHIES;
+        }
+        else if(router_type == "parallel_all_pairs"s)
+        {
+            routing_settings.router_type = route::RouterType::PARALLEL_ALL_PAIRS;
+        }
+        else if(router_type == "compact_all_pairs"s)
+        {
+            routing_settings.router_type = route::RouterType::COMPACT_ALL_PAIRS;
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown router type: "s + router_type);
+        }
+    }
+
+    if(json_routing_settings.count("thread_count"s) != 0)
+    {
+        routing_settings.thread_count = GetThreadCount(json_routing_settings);
+    }
+
+    if(json_routing_settings.count("walking_velocity"s) != 0)
+    {
+        routing_settings.walking_velocity = json_routing_settings.at("walking_velocity"s).AsDouble();
+        if(routing_settings.walking_velocity <= 0)
+        {
+            throw std::invalid_argument("Walking velocity should be positive");
+        }
+    }
+
+    if(json_routing_settings.count("walking_stop_count"s) != 0)
+    {
+        const int walking_stop_count = json_routing_settings.at("walking_stop_count"s).AsInt();
+        if(walking_stop_count <= 0)
+        {
+            throw std::invalid_argument("Walking stop count should be positive");
+        }
+        routing_settings.walking_stop_count = walking_stop_count;
+    }
+
     return routing_settings;
 }
 
@@ -25,10 +25,22 @@ public:
 
     void ExecMakeBase(std::istream& in);
     void ExecProcessRequest(std::istream& in, std::ostream& out);
+    // Первая строка - документ с serialization_settings, дальше по одному запросу в строке.
+    // На каждый запрос сразу выводится строка с ответом
+    void ExecStreamRequests(std::istream& in, std::ostream& out);
+    // Загружает базу по документу с serialization_settings и server_settings и обслуживает запросы
+    // клиентов Unix-сокета в том же построчном формате, пока процесс не получит SIGINT или SIGTERM.
+    // По SIGHUP база перечитывается из того же файла без остановки обслуживания
+    static void ExecServe(std::istream& in);
 
-    void RequestsProcessing(const json::Array& json_stat_requests, std::ostream& out);
+    // При thread_count > 1 запросы раздаются пачками потокам, ответы выводятся в порядке запросов по мере готовности
+    void RequestsProcessing(const json::Array& json_stat_requests, std::ostream& out, size_t thread_count = 1);
 
 private:
+    void LoadBase(const json::Dict& dictionary);
+    void ProcessRequestLine(std::string_view line, std::ostream& out);
+    void ProcessRequest(const json::Dict& stat_request_map, json::StreamWriter& writer);
+
     RequestHandler& request_handler_;
     transport::Catalogue& transport_catalogue_;
     transport::renderer::MapRenderer& map_renderer_;
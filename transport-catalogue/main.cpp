@@ -8,18 +8,24 @@ using namespace std::literals;
 
 void PrintUsage(std::ostream& stream = std::cerr)
 {
-    stream << "Usage: transport_catalogue [make_base|process_requests]\n"sv;
+    stream << "Usage: transport_catalogue [make_base|process_requests [--stream]|serve]\n"sv;
 }
 
 int main(int argc, char* argv[])
 {
-    if(argc != 2)
+    if(argc != 2 && argc != 3)
     {
         PrintUsage();
         return 1;
     }
 
     const std::string_view mode(argv[1]);
+    const std::string_view option(argc == 3 ? argv[2] : "");
+    if(!option.empty() && (mode != "process_requests"sv || option != "--stream"sv))
+    {
+        PrintUsage();
+        return 1;
+    }
 
     if(mode == "make_base"sv)
     {
@@ -37,7 +43,19 @@ int main(int argc, char* argv[])
         transport::renderer::MapRenderer map_renderer;
         transport::request::RequestHandler request_handler(transport_catalogue, transport_router, map_renderer);
         transport::request::JsonReader json_reader(request_handler, transport_catalogue, map_renderer, transport_router);
-        json_reader.ExecProcessRequest(std::cin, std::cout);
+        if(option.empty())
+        {
+            json_reader.ExecProcessRequest(std::cin, std::cout);
+        }
+        else
+        {
+            json_reader.ExecStreamRequests(std::cin, std::cout);
+        }
+    }
+    else if(mode == "serve"sv)
+    {
+        // Сервер сам создаёт справочник для каждой загруженной версии базы
+        transport::request::JsonReader::ExecServe(std::cin);
     }
     else
     {
@@ -3,6 +3,15 @@
 
 namespace transport::renderer {
 
+using namespace std::literals;
+
+namespace {
+
+const svg::Color STOP_COLOR{"white"s};
+const svg::Color STOP_NAME_COLOR{"black"s};
+
+} // namespace
+
 bool IsZero(double value)
 {
     return std::abs(value) < EPSILON;
@@ -11,6 +20,10 @@ bool IsZero(double value)
 void MapRenderer::SetSettings(Settings&& settings)
 {
     setting_ = std::move(settings);
+
+    // С другими настройками карта рисуется заново
+    rendered_map_storage_.reset();
+    rendered_map_.reset();
 }
 
 Settings MapRenderer::GetSettings()
@@ -27,117 +40,96 @@ void MapRenderer::CalculateSphereProjector(const std::vector<geo::Coordinates>&
                                         setting_.padding};
 }
 
-void MapRenderer::RenderBus(svg::Document& doc, const domain::Bus* bus, size_t color_number)
+void MapRenderer::RenderBus(svg::StreamWriter& writer, const domain::Bus* bus, size_t color_number)
 {
-    svg::Polyline polyline;
+    writer.BeginPolyline();
     for (const domain::Stop *stop: bus->stops_)
     {
-        polyline.AddPoint(sphere_projector_(stop->coordinates_));
+        writer.AddPolylinePoint(sphere_projector_(stop->coordinates_));
     }
 
     if (!bus->is_roundtrip_)
     {
         for (size_t i = bus->stops_.size() - 2; i > 0; --i)
         {
-            polyline.AddPoint(sphere_projector_(bus->stops_[i]->coordinates_));
+            writer.AddPolylinePoint(sphere_projector_(bus->stops_[i]->coordinates_));
         }
 
-        polyline.AddPoint(sphere_projector_(bus->stops_[0]->coordinates_));
+        writer.AddPolylinePoint(sphere_projector_(bus->stops_[0]->coordinates_));
     }
 
     size_t color = color_number % setting_.color_palette.size();
-    polyline.SetFillColor(svg::NoneColor)
-            .SetStrokeColor(setting_.color_palette[color])
-            .SetStrokeWidth(setting_.line_width)
-            .SetStrokeLineCap(svg::StrokeLineCap::ROUND)
-            .SetStrokeLineJoin(svg::StrokeLineJoin::ROUND);
-
-    doc.Add(polyline);
+    writer.EndPolyline({&svg::NoneColor,
+                        &setting_.color_palette[color],
+                        setting_.line_width,
+                        svg::StrokeLineCap::ROUND,
+                        svg::StrokeLineJoin::ROUND});
 }
 
-void MapRenderer::RenderBusName(svg::Document& doc, const domain::Bus* bus, size_t color_number)
+void MapRenderer::RenderBusName(svg::StreamWriter& writer, const domain::Bus* bus, size_t color_number)
 {
-    svg::Text text;
-    svg::Text text_background;
     size_t color = color_number % setting_.color_palette.size();
 
-    text_background.SetPosition(sphere_projector_({bus->stops_[0]->coordinates_}))
-            .SetOffset({setting_.bus_label_offset})
-            .SetFontSize(setting_.bus_label_font_size)
-            .SetFontFamily("Verdana").SetFontWeight("bold")
-            .SetData(bus->name_)
-            .SetFillColor(setting_.underlayer_color)
-            .SetStrokeColor(setting_.underlayer_color)
-            .SetStrokeWidth(setting_.underlayer_width)
-            .SetStrokeLineCap(svg::StrokeLineCap::ROUND)
-            .SetStrokeLineJoin(svg::StrokeLineJoin::ROUND);
-
-    text.SetPosition(sphere_projector_({bus->stops_[0]->coordinates_}))
-            .SetOffset({setting_.bus_label_offset})
-            .SetFontSize(setting_.bus_label_font_size).SetFontFamily("Verdana").SetFontWeight("bold").SetData(bus->name_)
-            .SetFillColor(setting_.color_palette[color]);
-
-    doc.Add(text_background);
-    doc.Add(text);
+    const svg::StreamWriter::TextAttrs text_attrs = {setting_.bus_label_offset,
+                                                     static_cast<uint32_t>(setting_.bus_label_font_size),
+                                                     "Verdana"sv,
+                                                     "bold"sv};
+    const svg::StreamWriter::PathAttrs background_attrs = {&setting_.underlayer_color,
+                                                           &setting_.underlayer_color,
+                                                           setting_.underlayer_width,
+                                                           svg::StrokeLineCap::ROUND,
+                                                           svg::StrokeLineJoin::ROUND};
+    const svg::StreamWriter::PathAttrs attrs = {&setting_.color_palette[color]};
+
+    const svg::Point begin = sphere_projector_(bus->stops_[0]->coordinates_);
+    writer.WriteText(begin, bus->name_, text_attrs, background_attrs);
+    writer.WriteText(begin, bus->name_, text_attrs, attrs);
 
     if(!bus->is_roundtrip_ && bus->stops_[0] != bus->stops_.back())
     {
-        text_background.SetPosition(sphere_projector_({bus->stops_.back()->coordinates_}))
-                .SetOffset({setting_.bus_label_offset})
-                .SetFontSize(setting_.bus_label_font_size)
-                .SetFontFamily("Verdana").SetFontWeight("bold")
-                .SetData(bus->name_)
-                .SetFillColor(setting_.underlayer_color)
-                .SetStrokeColor(setting_.underlayer_color)
-                .SetStrokeWidth(setting_.underlayer_width)
-                .SetStrokeLineCap(svg::StrokeLineCap::ROUND)
-                .SetStrokeLineJoin(svg::StrokeLineJoin::ROUND);
-
-        text.SetPosition(sphere_projector_({bus->stops_.back()->coordinates_}))
-                .SetOffset({setting_.bus_label_offset})
-                .SetFontSize(setting_.bus_label_font_size)
-                .SetFontFamily("Verdana").SetFontWeight("bold")
-                .SetData(bus->name_)
-                .SetFillColor(setting_.color_palette[color]);
-
-        doc.Add(text_background);
-        doc.Add(text);
+        const svg::Point end = sphere_projector_(bus->stops_.back()->coordinates_);
+        writer.WriteText(end, bus->name_, text_attrs, background_attrs);
+        writer.WriteText(end, bus->name_, text_attrs, attrs);
     }
 }
 
-void MapRenderer::RenderStop(svg::Document& doc, const domain::Stop* stop)
+void MapRenderer::RenderStop(svg::StreamWriter& writer, const domain::Stop* stop)
+{
+    writer.WriteCircle(sphere_projector_(stop->coordinates_), setting_.stop_radius, {&STOP_COLOR});
+}
+
+void MapRenderer::RenderStopName(svg::StreamWriter& writer, const domain::Stop* stop)
 {
-    svg::Circle stop_point;
-    stop_point.SetCenter(sphere_projector_({stop->coordinates_}))
-              .SetRadius(setting_.stop_radius)
-              .SetFillColor("white");
+    const svg::StreamWriter::TextAttrs text_attrs = {setting_.stop_label_offset,
+                                                     static_cast<uint32_t>(setting_.stop_label_font_size),
+                                                     "Verdana"sv};
+    const svg::StreamWriter::PathAttrs background_attrs = {&setting_.underlayer_color,
+                                                           &setting_.underlayer_color,
+                                                           setting_.underlayer_width,
+                                                           svg::StrokeLineCap::ROUND,
+                                                           svg::StrokeLineJoin::ROUND};
+
+    const svg::Point position = sphere_projector_(stop->coordinates_);
+    writer.WriteText(position, stop->name_, text_attrs, background_attrs);
+    writer.WriteText(position, stop->name_, text_attrs, {&STOP_NAME_COLOR});
+}
 
-    doc.Add(stop_point);
+void MapRenderer::SetRenderedMap(std::string map)
+{
+    auto storage = std::make_shared<const std::string>(std::move(map));
+    const std::string_view view = *storage;
+    SetRenderedMap(std::move(storage), view);
+}
+
+void MapRenderer::SetRenderedMap(std::shared_ptr<const void> storage, std::string_view map)
+{
+    rendered_map_storage_ = std::move(storage);
+    rendered_map_ = map;
 }
 
-void MapRenderer::RenderStopName(svg::Document& doc, const domain::Stop* stop)
+std::optional<std::string_view> MapRenderer::GetRenderedMap() const
 {
-    svg::Text text;
-    svg::Text text_background;
-
-    text_background.SetPosition(sphere_projector_({stop->coordinates_}))
-                   .SetOffset({setting_.stop_label_offset})
-                   .SetFontSize(setting_.stop_label_font_size)
-                   .SetFontFamily("Verdana").SetData(stop->name_)
-                   .SetFillColor(setting_.underlayer_color)
-                   .SetStrokeColor(setting_.underlayer_color)
-                   .SetStrokeWidth(setting_.underlayer_width)
-                   .SetStrokeLineCap(svg::StrokeLineCap::ROUND)
-                   .SetStrokeLineJoin(svg::StrokeLineJoin::ROUND);
-
-    text.SetPosition(sphere_projector_({stop->coordinates_}))
-        .SetOffset({setting_.stop_label_offset})
-        .SetFontSize(setting_.stop_label_font_size)
-        .SetFontFamily("Verdana").SetData(stop->name_)
-        .SetFillColor("black");
-
-    doc.Add(text_background);
-    doc.Add(text);
+    return rendered_map_;
 }
 
 } // namespace transport::renderer
@@ -5,6 +5,10 @@
 #include "domain.h"
 #include "transport_catalogue.h"
 #include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace transport::renderer {
 
@@ -115,14 +119,23 @@ public:
 
     void CalculateSphereProjector(const std::vector<geo::Coordinates>& points);
 
-    void RenderBus(svg::Document& doc, const domain::Bus* bus, size_t color_number);
-    void RenderBusName(svg::Document& doc, const domain::Bus* bus, size_t color_number);
-    void RenderStop(svg::Document& doc, const domain::Stop* stop);
-    void RenderStopName(svg::Document& doc, const domain::Stop* stop);
+    void RenderBus(svg::StreamWriter& writer, const domain::Bus* bus, size_t color_number);
+    void RenderBusName(svg::StreamWriter& writer, const domain::Bus* bus, size_t color_number);
+    void RenderStop(svg::StreamWriter& writer, const domain::Stop* stop);
+    void RenderStopName(svg::StreamWriter& writer, const domain::Stop* stop);
+
+    // Готовая карта в SVG. Зависит только от базы, поэтому рисуется один раз;
+    // storage держит память, в которой лежит map, например отображённый файл базы
+    void SetRenderedMap(std::string map);
+    void SetRenderedMap(std::shared_ptr<const void> storage, std::string_view map);
+    std::optional<std::string_view> GetRenderedMap() const;
 
 private:
     Settings setting_;
     SphereProjector sphere_projector_;
+
+    std::shared_ptr<const void> rendered_map_storage_;
+    std::optional<std::string_view> rendered_map_;
 };
 
 } // namespace transport::renderer
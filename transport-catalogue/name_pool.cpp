@@ -0,0 +1,75 @@
+#include "name_pool.h"
+
+#include <functional>
+#include <stdexcept>
+
+namespace domain {
+
+NameId NamePool::Intern(std::string_view name)
+{
+    // Заполненность таблицы не больше половины
+    if((names_.size() + 1) * 2 > slots_.size())
+    {
+        Rehash(slots_.empty() ? MIN_CAPACITY : slots_.size() * 2);
+    }
+
+    const size_t slot = FindSlot(name);
+    if(slots_[slot] != NO_NAME)
+    {
+        return slots_[slot];
+    }
+
+    const NameId id = static_cast<NameId>(names_.size());
+    names_.push_back(arena_.CopyString(name));
+    slots_[slot] = id;
+
+    return id;
+}
+
+NameId NamePool::Find(std::string_view name) const
+{
+    if(slots_.empty())
+    {
+        return NO_NAME;
+    }
+
+    return slots_[FindSlot(name)];
+}
+
+std::string_view NamePool::GetName(NameId id) const
+{
+    if(id >= names_.size())
+    {
+        throw std::out_of_range("Name id is out of range");
+    }
+
+    return names_[id];
+}
+
+size_t NamePool::GetSize() const
+{
+    return names_.size();
+}
+
+size_t NamePool::FindSlot(std::string_view name) const
+{
+    const size_t mask = slots_.size() - 1;
+    size_t slot = std::hash<std::string_view>{}(name) & mask;
+    while(slots_[slot] != NO_NAME && names_[slots_[slot]] != name)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+void NamePool::Rehash(size_t capacity)
+{
+    slots_.assign(capacity, NO_NAME);
+    for(NameId id = 0; id < names_.size(); ++id)
+    {
+        slots_[FindSlot(names_[id])] = id;
+    }
+}
+
+} // namespace domain
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "arena.h"
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace domain {
+
+using NameId = uint32_t;
+
+// Пул имён остановок и маршрутов: каждое имя хранится ровно один раз, номер имени даёт string_view,
+// а номер по строке ищется в хеш-таблице с открытой адресацией.
+// Строки не перемещаются, поэтому string_view из пула живут столько же, сколько сам пул
+class NamePool
+{
+public:
+    static constexpr NameId NO_NAME = std::numeric_limits<NameId>::max();
+
+    NamePool() = default;
+    NamePool(const NamePool&) = delete;
+    NamePool& operator=(const NamePool&) = delete;
+
+    NameId Intern(std::string_view name);
+    NameId Find(std::string_view name) const;
+
+    std::string_view GetName(NameId id) const;
+    size_t GetSize() const;
+
+private:
+    static constexpr size_t MIN_CAPACITY = 64;
+
+    size_t FindSlot(std::string_view name) const;
+    void Rehash(size_t capacity);
+
+    memory::Arena arena_;
+    std::vector<std::string_view> names_;
+    std::vector<NameId> slots_;
+};
+
+} // namespace domain
@@ -1,5 +1,7 @@
 #include "request_handler.h"
 
+#include <algorithm>
+
 namespace transport::request {
 
 RequestHandler::RequestHandler(transport::Catalogue& transport_catalogue,
@@ -10,12 +12,12 @@ RequestHandler::RequestHandler(transport::Catalogue& transport_catalogue,
 }
 
 
-void RequestHandler::AddStop(const std::string& name, double lat, double lng)
+void RequestHandler::AddStop(std::string_view name, double lat, double lng)
 {
     transport_catalogue_.AddStop(name, lat, lng);
 }
 
-void RequestHandler::AddBus(const std::string& name, const std::vector<std::string>& stops, bool is_roundtrip)
+void RequestHandler::AddBus(std::string_view name, const std::vector<std::string>& stops, bool is_roundtrip)
 {
     transport_catalogue_.AddBus(name, stops, is_roundtrip);
 }
@@ -25,6 +27,11 @@ void RequestHandler::AddDistance(const std::string& stop1, const std::string& st
     transport_catalogue_.AddDistance(stop1, stop2, distance);
 }
 
+void RequestHandler::AddDistance(domain::StopId stop1, domain::StopId stop2, uint32_t distance)
+{
+    transport_catalogue_.AddDistance(stop1, stop2, distance);
+}
+
 std::vector<const domain::Stop*> RequestHandler::GetStops() const
 {
     return transport_catalogue_.GetStops();
@@ -45,6 +52,16 @@ double RequestHandler::GetDistance(const std::string& stop1, const std::string&
     return transport_catalogue_.GetDistance(stop1, stop2);
 }
 
+double RequestHandler::GetDistance(domain::StopId stop1, domain::StopId stop2) const
+{
+    return transport_catalogue_.GetDistance(stop1, stop2);
+}
+
+domain::Stop* RequestHandler::FindStop(std::string_view name) const
+{
+    return transport_catalogue_.FindStop(name);
+}
+
 domain::Bus* RequestHandler::FindBus(const std::string_view& name) const
 {
     return transport_catalogue_.FindBus(name);
@@ -60,6 +77,38 @@ domain::BusInfo RequestHandler::GetBusInfo(std::string_view name) const
     return transport_catalogue_.GetBusInfo(name);
 }
 
+void RequestHandler::BuildStopIndex()
+{
+    transport_catalogue_.BuildStopIndex();
+}
+
+std::vector<std::pair<const domain::Stop*, double>> RequestHandler::FindNearestStops(geo::Coordinates point, size_t count) const
+{
+    std::vector<std::pair<const domain::Stop*, double>> result;
+    for(const auto& neighbour : transport_catalogue_.GetStopIndex().FindNearest(point, count))
+    {
+        result.emplace_back(transport_catalogue_.FindStop(neighbour.id), neighbour.distance);
+    }
+
+    return result;
+}
+
+std::vector<const domain::Stop*> RequestHandler::FindStopsInBox(const geo::SpatialIndex::Box& box) const
+{
+    std::vector<const domain::Stop*> result;
+    for(const uint32_t id : transport_catalogue_.GetStopIndex().FindInBox(box))
+    {
+        result.push_back(transport_catalogue_.FindStop(id));
+    }
+
+    std::sort(result.begin(), result.end(), [](const domain::Stop* lhs, const domain::Stop* rhs)
+    {
+        return lhs->name_ < rhs->name_;
+    });
+
+    return result;
+}
+
 
 void RequestHandler::SetRoutingSettings(route::Settings&& routing_settings)
 {
@@ -91,85 +140,132 @@ std::optional<route::RouteInfo> RequestHandler::GetRouteInfo(std::string_view fr
     return transport_router_.GetRouteInfo(from, to);
 }
 
+std::optional<route::RouteInfo> RequestHandler::GetRouteInfo(const RouteEndpoint& from, const RouteEndpoint& to) const
+{
+    const auto* from_name = std::get_if<std::string_view>(&from);
+    const auto* to_name = std::get_if<std::string_view>(&to);
+    if(from_name != nullptr && to_name != nullptr)
+    {
+        return transport_router_.GetRouteInfo(*from_name, *to_name);
+    }
+
+    auto route_info = transport_router_.GetRouteInfo(GetStopAccess(from), GetStopAccess(to));
+
+    if(from_name == nullptr && to_name == nullptr)
+    {
+        const double walk_time = transport_router_.ComputeWalkTime(geo::ComputeDistance(std::get<geo::Coordinates>(from),
+                                                                                        std::get<geo::Coordinates>(to)));
+        if(!route_info || walk_time <= route_info->total_time)
+        {
+            route::RouteItem item;
+            item.walk_item = {{}, walk_time};
+            return route::RouteInfo{walk_time, {item}};
+        }
+    }
+
+    return route_info;
+}
+
+std::vector<route::StopAccess> RequestHandler::GetStopAccess(const RouteEndpoint& endpoint) const
+{
+    if(const auto* name = std::get_if<std::string_view>(&endpoint))
+    {
+        return {{*name, 0.0}};
+    }
+
+    std::vector<route::StopAccess> result;
+    const auto point = std::get<geo::Coordinates>(endpoint);
+    for(const auto& [stop, distance] : FindNearestStops(point, transport_router_.GetSettings().walking_stop_count))
+    {
+        result.push_back({stop->name_, transport_router_.ComputeWalkTime(distance)});
+    }
+
+    return result;
+}
+
 void RequestHandler::SetRendererSettings(transport::renderer::Settings&& renderer_settings)
 {
     map_renderer_.SetSettings(std::move(renderer_settings));
 }
 
-svg::Document RequestHandler::RenderMap() const
+std::string_view RequestHandler::GetMap() const
+{
+    std::lock_guard guard(render_mutex_);
+
+    if(!map_renderer_.GetRenderedMap())
+    {
+        map_renderer_.SetRenderedMap(RenderMapUnlocked());
+    }
+
+    return *map_renderer_.GetRenderedMap();
+}
+
+std::string RequestHandler::RenderMap() const
+{
+    std::lock_guard guard(render_mutex_);
+
+    return RenderMapUnlocked();
+}
+
+std::string RequestHandler::RenderMapUnlocked() const
 {
-    svg::Document result;
+
+    // Справочник хранит маршруты и обслуживаемые остановки уже в порядке имён, поэтому отбор линеен
     std::vector<const domain::Bus *> buses_for_render;
-    std::vector<const domain::Stop *> stops_for_render;
+    for(const auto *bus : transport_catalogue_.GetBusesSortedByName())
+    {
+        if(!bus->stops_.empty())
+        {
+            buses_for_render.push_back(bus);
+        }
+    }
 
-    std::unordered_set<const domain::Stop *> usered_stops;
+    std::vector<const domain::Stop *> stops_for_render;
     std::vector<geo::Coordinates> points;
-
-    for(const auto *route : transport_catalogue_.GetBuses())
+    if(!buses_for_render.empty())
     {
-        if(!route->stops_.empty())
+        const auto& served_stops = transport_catalogue_.GetServedStopsSortedByName();
+        stops_for_render.assign(served_stops.begin(), served_stops.end());
+
+        points.reserve(stops_for_render.size());
+        for(const auto *stop : stops_for_render)
         {
-            buses_for_render.push_back(route);
-            for(const auto *stop: transport_catalogue_.GetStops())
-            {
-                if(usered_stops.count(stop) == 0 && transport_catalogue_.HasBuses(stop))
-                {
-                    usered_stops.insert(stop);
-                    stops_for_render.push_back(stop);
-                    points.push_back(stop->coordinates_);
-                }
-            }
+            points.push_back(stop->coordinates_);
         }
     }
 
     map_renderer_.CalculateSphereProjector(points);
 
-    std::sort(buses_for_render.begin(), buses_for_render.end(), [](const domain::Bus *lhs, const domain::Bus *rhs) {
-        return lhs->name_ < rhs->name_;
-    });
-
-    std::sort(stops_for_render.begin(), stops_for_render.end(), [](const domain::Stop *lhs, const domain::Stop *rhs) {
-        return lhs->name_ < rhs->name_;
-    });
+    std::string result;
+    svg::StreamWriter writer(result);
+    writer.BeginDocument();
 
     size_t color_counter = 0;
     for(const domain::Bus *bus : buses_for_render)
     {
-        map_renderer_.RenderBus(result, bus, color_counter);
+        map_renderer_.RenderBus(writer, bus, color_counter);
         ++color_counter;
     }
 
     color_counter = 0;
     for(const domain::Bus *bus : buses_for_render)
     {
-        map_renderer_.RenderBusName(result, bus, color_counter);
+        map_renderer_.RenderBusName(writer, bus, color_counter);
         ++color_counter;
     }
 
-    usered_stops = {};
-    for(const domain::Stop *stop: stops_for_render)
+    for(const domain::Stop *stop : stops_for_render)
     {
-        if(usered_stops.count(stop) > 0 || transport_catalogue_.GetBusesByStop(stop->name_).empty())
-        {
-            continue;
-        }
-
-        map_renderer_.RenderStop(result, stop);
-        usered_stops.insert(stop);
+        map_renderer_.RenderStop(writer, stop);
     }
 
-    usered_stops = {};
-    for(const domain::Stop *stop: stops_for_render)
+    for(const domain::Stop *stop : stops_for_render)
     {
-        if(usered_stops.count(stop) > 0 || transport_catalogue_.GetBusesByStop(stop->name_).empty())
-        {
-            continue;
-        }
-
-        map_renderer_.RenderStopName(result, stop);
-        usered_stops.insert(stop);
+        map_renderer_.RenderStopName(writer, stop);
     }
 
+    writer.EndDocument();
+
     return result;
 }
 
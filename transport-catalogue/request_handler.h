@@ -5,10 +5,14 @@
 #include "transport_router.h"
 #include "map_renderer.h"
 #include "serialization.h"
-#include <unordered_set>
+#include <mutex>
+#include <variant>
 
 namespace transport::request {
 
+// Начало или конец маршрута: остановка по имени или произвольная точка
+using RouteEndpoint = std::variant<std::string_view, geo::Coordinates>;
+
 class RequestHandler
 {
 public:
@@ -16,32 +20,51 @@ public:
                    route::TransportRouter& transport_router,
                    transport::renderer::MapRenderer& map_renderer);
 
-    void AddStop(const std::string& name, double lat, double lng);
-    void AddBus(const std::string& name, const std::vector<std::string>& stops, bool is_roundtrip);
+    void AddStop(std::string_view name, double lat, double lng);
+    void AddBus(std::string_view name, const std::vector<std::string>& stops, bool is_roundtrip);
     void AddDistance(const std::string& stop1, const std::string& stop2, uint32_t distance);
+    void AddDistance(domain::StopId stop1, domain::StopId stop2, uint32_t distance);
     std::vector<const domain::Stop*> GetStops() const;
     std::vector<const domain::Bus*> GetBuses() const;
     std::vector<domain::Stop*> GetBusStops(const domain::Bus* bus);
     double GetDistance(const std::string& stop1, const std::string& stop2) const;
+    double GetDistance(domain::StopId stop1, domain::StopId stop2) const;
+    domain::Stop* FindStop(std::string_view name) const;
     domain::Bus* FindBus(const std::string_view& name) const;
     domain::StopInfo GetStopInfo(std::string_view name) const;
     domain::BusInfo GetBusInfo(std::string_view name) const;
 
+    void BuildStopIndex();
+    // Ближайшие остановки с расстоянием до них в метрах, по возрастанию расстояния
+    std::vector<std::pair<const domain::Stop*, double>> FindNearestStops(geo::Coordinates point, size_t count) const;
+    // Остановки внутри прямоугольника в порядке имён
+    std::vector<const domain::Stop*> FindStopsInBox(const geo::SpatialIndex::Box& box) const;
+
     void SetRoutingSettings(route::Settings&& routing_settings);
     void AddStopToRouter(std::string_view name);
     void AddWaitEdgeToRouter(std::string_view stop_name);
     void AddBusEdgeToRouter(std::string_view stop_from, std::string_view stop_to, std::string_view bus_name, int span_count, int dist);
     void BuildRouter();
     std::optional<route::RouteInfo> GetRouteInfo(std::string_view from, std::string_view to) const;
+    // От точки до ближайших к ней остановок идём пешком, между двумя точками можно пройти и напрямую
+    std::optional<route::RouteInfo> GetRouteInfo(const RouteEndpoint& from, const RouteEndpoint& to) const;
 
     void SetRendererSettings(transport::renderer::Settings&& renderer_settings);
 
-    svg::Document RenderMap() const;
+    // Отрисовка пересчитывает проекцию в MapRenderer, поэтому из разных потоков карты рисуются по очереди
+    std::string RenderMap() const;
+    // Карта рисуется при первом запросе, если её нет в базе, дальше отдаётся готовая строка
+    std::string_view GetMap() const;
 
 private:
+    std::vector<route::StopAccess> GetStopAccess(const RouteEndpoint& endpoint) const;
+    std::string RenderMapUnlocked() const;
+
     transport::Catalogue& transport_catalogue_;
     route::TransportRouter& transport_router_;
     transport::renderer::MapRenderer& map_renderer_;
+
+    mutable std::mutex render_mutex_;
 };
 
 } // namespace transport::request
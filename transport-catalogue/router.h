@@ -14,6 +14,41 @@
 
 namespace graph {
 
+// Начало или конец маршрута с добавочным весом, например временем пешком между точкой и остановкой
+template <typename Weight>
+struct RouteTerminal
+{
+    VertexId vertex;
+    Weight weight;
+};
+
+// Маршрут между лучшей парой начало-конец: номера в списках начал и концов,
+// вес вместе с добавочными весами обоих концов
+template <typename Weight>
+struct TerminalRouteInfo
+{
+    size_t source;
+    size_t target;
+    Weight weight;
+    std::vector<EdgeId> edges;
+};
+
+// Номер начала (или конца) в вершине vertex с наименьшим добавочным весом
+template <typename Weight>
+size_t FindTerminal(const std::vector<RouteTerminal<Weight>>& terminals, VertexId vertex)
+{
+    size_t result = terminals.size();
+    for(size_t i = 0; i < terminals.size(); ++i)
+    {
+        if(terminals[i].vertex == vertex && (result == terminals.size() || terminals[i].weight < terminals[result].weight))
+        {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
 template <typename Weight>
 class Router
 {
@@ -35,9 +70,10 @@ public:
     using RoutesInternalData = std::vector<std::vector<std::optional<RouteInternalData>>>;
 
     explicit Router(const Graph& graph);
-    explicit Router(const Graph& graph, const std::optional<RoutesInternalData>& routes_internal_data);
+    explicit Router(const Graph& graph, std::optional<RoutesInternalData> routes_internal_data);
 
     std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+    const RoutesInternalData& GetRoutesInternalData() const;
 
 private:
     void InitializeRoutesInternalData(const Graph& graph)
@@ -46,9 +82,8 @@ private:
         for(VertexId vertex = 0; vertex < vertex_count; ++vertex)
         {
             routes_internal_data_[vertex][vertex] = RouteInternalData{ZERO_WEIGHT, std::nullopt};
-            for(const EdgeId edge_id : graph.GetIncidentEdges(vertex))
+            for(const auto& edge : graph.GetAdjacentEdges(vertex))
             {
-                const auto& edge = graph.GetEdge(edge_id);
                 if(edge.weight < ZERO_WEIGHT)
                 {
                     throw std::domain_error("Edges' weights should be non-negative");
@@ -56,7 +91,7 @@ private:
                 auto& route_internal_data = routes_internal_data_[vertex][edge.to];
                 if(!route_internal_data || route_internal_data->weight > edge.weight)
                 {
-                    route_internal_data = RouteInternalData{edge.weight, edge_id};
+                    route_internal_data = RouteInternalData{edge.weight, edge.id};
                 }
             }
         }
@@ -89,29 +124,88 @@ private:
         }
     }
 
+    // Загруженная таблица должна задавать для каждой начальной вершины дерево кратчайших путей:
+    // иначе восстановление маршрута выйдет за пределы графа или зациклится
+    void CheckRoutesInternalData() const
+    {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if(routes_internal_data_.size() != vertex_count)
+        {
+            throw std::invalid_argument("Routes internal data doesn't match the graph");
+        }
+
+        // Вершины, путь до которых уже проверен в строке reached_from[vertex]
+        std::vector<VertexId> reached_from(vertex_count, vertex_count);
+        std::vector<VertexId> path;
+        for(VertexId vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+        {
+            const auto& row = routes_internal_data_[vertex_from];
+            if(row.size() != vertex_count || !row[vertex_from] || row[vertex_from]->prev_edge)
+            {
+                throw std::invalid_argument("Broken routes internal data");
+            }
+            reached_from[vertex_from] = vertex_from;
+
+            for(VertexId vertex_to = 0; vertex_to < vertex_count; ++vertex_to)
+            {
+                path.clear();
+                for(VertexId vertex = vertex_to; row[vertex] && reached_from[vertex] != vertex_from;)
+                {
+                    const std::optional<EdgeId>& prev_edge = row[vertex]->prev_edge;
+                    if(!prev_edge || *prev_edge >= graph_.GetEdgeCount() || graph_.GetEdge(*prev_edge).to != vertex
+                       || path.size() == vertex_count)
+                    {
+                        throw std::invalid_argument("Broken routes internal data");
+                    }
+
+                    path.push_back(vertex);
+                    vertex = graph_.GetEdge(*prev_edge).from;
+                    if(!row[vertex])
+                    {
+                        throw std::invalid_argument("Broken routes internal data");
+                    }
+                }
+
+                for(const VertexId vertex : path)
+                {
+                    reached_from[vertex] = vertex_from;
+                }
+            }
+        }
+    }
+
     static constexpr Weight ZERO_WEIGHT{};
     const Graph& graph_;
     RoutesInternalData routes_internal_data_;
 };
 
 template <typename Weight>
-Router<Weight>::Router(const Graph& graph) : graph_(graph), routes_internal_data_(graph.GetVertexCount(),
-                                                                                  std::vector<std::optional<RouteInternalData>>(graph.GetVertexCount()))
+Router<Weight>::Router(const Graph& graph) : Router(graph, std::nullopt)
 {
-    InitializeRoutesInternalData(graph);
+}
+
+// Если таблица маршрутов уже посчитана (например, загружена из базы), используем её как есть,
+// иначе вычисляем кратчайшие пути между всеми парами вершин
+template <typename Weight>
+Router<Weight>::Router(const Graph& graph, std::optional<RoutesInternalData> routes_internal_data) : graph_(graph)
+{
+    if(routes_internal_data)
+    {
+        routes_internal_data_ = std::move(*routes_internal_data);
+        CheckRoutesInternalData();
+        return;
+    }
 
     const size_t vertex_count = graph.GetVertexCount();
+    routes_internal_data_.assign(vertex_count, std::vector<std::optional<RouteInternalData>>(vertex_count));
+    InitializeRoutesInternalData(graph);
+
     for(VertexId vertex_through = 0; vertex_through < vertex_count; ++vertex_through)
     {
         RelaxRoutesInternalDataThroughVertex(vertex_count, vertex_through);
     }
 }
 
-template <typename Weight>
-Router<Weight>::Router(const Graph& graph, const std::optional<RoutesInternalData>& routes_internal_data) : graph_(graph), routes_internal_data_(routes_internal_data)
-{
-}
-
 
 template <typename Weight>
 std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from, VertexId to) const
@@ -134,4 +228,10 @@ std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(Ver
     return RouteInfo{weight, std::move(edges)};
 }
 
+template <typename Weight>
+const typename Router<Weight>::RoutesInternalData& Router<Weight>::GetRoutesInternalData() const
+{
+    return routes_internal_data_;
+}
+
 }  // namespace graph
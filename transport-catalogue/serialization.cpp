@@ -1,6 +1,10 @@
 #include "serialization.h"
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
+#include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 
 namespace proto {
@@ -17,19 +21,54 @@ Serializer::Serializer(transport::Catalogue& transport_catalogue,
 
 void Serializer::operator()(const std::string& file)
 {
+    SerializationNames();
     SerializationStops();
     SerializationDistances();
     SerializationBuses();
+    SerializationStopIndex();
 
     SerializationRenderSettings();
+    SerializationRenderedMap();
 
     SerializationRouterSettings();
     SerializationGraph();
     SerializationVertexIds();
     SerializationRouteInfo();
+    SerializationRoutesInternalData();
+    SerializationContractionHierarchy();
 
-    std::ofstream out(file, std::ios::binary);
-    proto_main_.SerializeToOstream(&out);
+    // База пишется рядом и подменяет прежнюю переименованием, так что работающий сервер не прочитает её недописанной
+    const std::string temp_file = file + ".tmp"s;
+    {
+        std::ofstream out(temp_file, std::ios::binary);
+        if(!proto_main_.SerializeToOstream(&out) || !out.flush())
+        {
+            throw std::runtime_error("Can't write base file "s + file);
+        }
+    }
+    if(std::rename(temp_file.c_str(), file.c_str()) != 0)
+    {
+        throw std::system_error(errno, std::generic_category(), "Can't replace base file "s + file);
+    }
+}
+
+std::string Serializer::SerializeSettings()
+{
+    proto_main_.Clear();
+
+    SerializationRenderSettings();
+    SerializationRouterSettings();
+
+    return proto_main_.SerializeAsString();
+}
+
+void Serializer::SerializationNames()
+{
+    const domain::NamePool& names = transport_catalogue_.GetNamePool();
+    for(domain::NameId id = 0; id < names.GetSize(); ++id)
+    {
+        proto_main_.mutable_transport_catalogue()->add_names(std::string(names.GetName(id)));
+    }
 }
 
 void Serializer::SerializationStops()
@@ -41,7 +80,7 @@ void Serializer::SerializationStops()
         proto_coordinates.set_lng(stop->coordinates_.lng);
 
         Stop proto_stop;
-        proto_stop.set_name(stop->name_);
+        proto_stop.set_name_id(stop->name_id_);
         *proto_stop.mutable_coordinates() = proto_coordinates;
 
         *proto_main_.mutable_transport_catalogue()->add_stops() = proto_stop;
@@ -50,17 +89,14 @@ void Serializer::SerializationStops()
 
 void Serializer::SerializationDistances()
 {
-    for(const auto& [stop1, stop2_distance] : transport_catalogue_.GetAllDistances())
+    for(const auto& [stop1, stop2, distance] : transport_catalogue_.GetAllDistances())
     {
-        for(const auto& [stop2, distance] : stop2_distance)
-        {
-            Distance proto_distance;
-            proto_distance.set_stop_from(std::string(stop1));
-            proto_distance.set_stop_to(std::string(stop2));
-            proto_distance.set_distance(distance);
+        Distance proto_distance;
+        proto_distance.set_stop_from_id(stop1);
+        proto_distance.set_stop_to_id(stop2);
+        proto_distance.set_distance(distance);
 
-            *proto_main_.mutable_transport_catalogue()->add_distances() = proto_distance;
-        }
+        *proto_main_.mutable_transport_catalogue()->add_distances() = proto_distance;
     }
 }
 
@@ -70,26 +106,28 @@ void Serializer::SerializationBuses()
     {
         Bus proto_bus;
 
-        proto_bus.set_name(bus->name_);
+        proto_bus.set_name_id(bus->name_id_);
         proto_bus.set_is_roundtrip(bus->is_roundtrip_);
+        proto_bus.set_stop_count(bus->stops_count_);
+        proto_bus.set_unique_stop_count(bus->unique_stops_count_);
+        proto_bus.set_route_length(bus->distance_);
+        proto_bus.set_curvature(bus->curvature_);
 
         for(const auto& stop : bus->stops_)
         {
-            Coordinates proto_coordinates;
-            proto_coordinates.set_lat(stop->coordinates_.lat);
-            proto_coordinates.set_lng(stop->coordinates_.lng);
-
-            Stop proto_stop;
-            proto_stop.set_name(stop->name_);
-            *proto_stop.mutable_coordinates() = proto_coordinates;
-
-            *proto_bus.add_stops() = proto_stop;
+            proto_bus.add_stop_ids(stop->id_);
         }
 
         *proto_main_.mutable_transport_catalogue()->add_buses() = proto_bus;
     }
 }
 
+void Serializer::SerializationStopIndex()
+{
+    const auto& order = transport_catalogue_.GetStopIndex().GetOrder();
+    *proto_main_.mutable_transport_catalogue()->mutable_stop_index() = {order.begin(), order.end()};
+}
+
 void Serializer::SerializationRenderSettings()
 {
     transport::renderer::Settings renderer_settings = map_renderer_.GetSettings();
@@ -126,6 +164,14 @@ void Serializer::SerializationRenderSettings()
     *proto_main_.mutable_render_settings() = proto_render_settings;
 }
 
+void Serializer::SerializationRenderedMap()
+{
+    if(const auto map = map_renderer_.GetRenderedMap())
+    {
+        proto_main_.set_rendered_map(std::string(*map));
+    }
+}
+
 Color Serializer::SerializationColor(const svg::Color& color)
 {
     Color proto_color;
@@ -168,30 +214,45 @@ void Serializer::SerializationRouterSettings()
     RoutingSettings proto_routing_settings;
     proto_routing_settings.set_bus_wait_time(router.bus_wait_time);
     proto_routing_settings.set_bus_velocity(router.bus_velocity);
+    proto_routing_settings.set_walking_velocity(router.walking_velocity);
+    proto_routing_settings.set_walking_stop_count(router.walking_stop_count);
+    switch(router.router_type)
+    {
+        case route::RouterType::ALL_PAIRS:
+            proto_routing_settings.set_router_type(RouterType::ALL_PAIRS);
+            break;
+        case route::RouterType::DIJKSTRA:
+            proto_routing_settings.set_router_type(RouterType::DIJKSTRA);
+            break;
+        case route::RouterType::CONTRACTION_HIERARCHIES:
+            proto_routing_settings.set_router_type(RouterType::CONTRACTION_HIERARCHIES);
+            break;
+        case route::RouterType::PARALLEL_ALL_PAIRS:
+            proto_routing_settings.set_router_type(RouterType::PARALLEL_ALL_PAIRS);
+            break;
+        case route::RouterType::COMPACT_ALL_PAIRS:
+            proto_routing_settings.set_router_type(RouterType::COMPACT_ALL_PAIRS);
+            break;
+    }
 
     *proto_main_.mutable_transport_router()->mutable_routing_settings() = proto_routing_settings;
 }
 
 void Serializer::SerializationGraph()
 {
-    const auto& edges = transport_router_.GetGraph()->GetEdges();
-    for(const auto& edge : edges)
+    const auto& graph = *transport_router_.GetGraph();
+    auto& proto_graph = *proto_main_.mutable_transport_router()->mutable_graph();
+
+    // Списки инцидентности не сохраняем: граф восстанавливается из рёбер сразу в CSR
+    proto_graph.set_vertex_count(graph.GetVertexCount());
+    proto_graph.mutable_edges()->Reserve(graph.GetEdgeCount());
+    for(const auto& edge : graph.GetEdges())
     {
-        auto& proto_edge = *proto_main_.mutable_transport_router()->mutable_graph()->add_edges();
+        auto& proto_edge = *proto_graph.add_edges();
         proto_edge.set_from(edge.from);
         proto_edge.set_to(edge.to);
         proto_edge.set_weight(edge.weight);
     }
-
-    const auto& incidence_lists = transport_router_.GetGraph()->GetIncidenceLists();
-    for(const auto& incidence_list : incidence_lists)
-    {
-        auto& proto_incidence_list = *proto_main_.mutable_transport_router()->mutable_graph()->add_incidence_lists();
-        for(const auto& edge_id : incidence_list)
-        {
-            proto_incidence_list.add_list(edge_id);
-        }
-    }
 }
 
 void Serializer::SerializationVertexIds()
@@ -199,7 +260,7 @@ void Serializer::SerializationVertexIds()
     for(const auto& [stop, vertex_ids] : transport_router_.GetStopVertexIds())
     {
         auto& proto_stop_vertex_ids = *proto_main_.mutable_transport_router()->add_stop_vertex_ids();
-        proto_stop_vertex_ids.set_name(std::string(stop));
+        proto_stop_vertex_ids.set_stop_id(transport_catalogue_.FindStop(stop)->id_);
         proto_stop_vertex_ids.set_start_wait(vertex_ids.start_wait);
         proto_stop_vertex_ids.set_end_wait(vertex_ids.end_wait);
     }
@@ -210,7 +271,7 @@ void Serializer::SerializationRouteInfo()
     for(const auto& info : transport_router_.GetEdgesInfo())
     {
         auto& proto_edges_info = *proto_main_.mutable_transport_router()->add_edges_info();
-        proto_edges_info.set_name(std::string(info.name));
+        proto_edges_info.set_name_id(transport_catalogue_.GetNamePool().Find(info.name));
         proto_edges_info.set_span_count(info.span_count);
         proto_edges_info.set_time(info.time);
 
@@ -222,6 +283,59 @@ void Serializer::SerializationRouteInfo()
     }
 }
 
+void Serializer::SerializationRoutesInternalData()
+{
+    const route::RouterType router_type = transport_router_.GetSettings().router_type;
+    if(router_type != route::RouterType::ALL_PAIRS && router_type != route::RouterType::PARALLEL_ALL_PAIRS
+       && router_type != route::RouterType::COMPACT_ALL_PAIRS)
+    {
+        return;
+    }
+
+    const size_t vertex_count = transport_router_.GetGraph()->GetVertexCount();
+    for(size_t vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+    {
+        auto& proto_row = *proto_main_.mutable_transport_router()->add_routes_internal_data();
+        for(size_t vertex_to = 0; vertex_to < vertex_count; ++vertex_to)
+        {
+            const auto route = transport_router_.GetRouteInternalData(vertex_from, vertex_to);
+            if(!route)
+            {
+                continue;
+            }
+
+            proto_row.add_vertex_to(vertex_to);
+            proto_row.add_weight(route->weight);
+            proto_row.add_prev_edge(route->prev_edge ? static_cast<int64_t>(*route->prev_edge) : -1);
+        }
+    }
+}
+
+void Serializer::SerializationContractionHierarchy()
+{
+    if(transport_router_.GetSettings().router_type != route::RouterType::CONTRACTION_HIERARCHIES)
+    {
+        return;
+    }
+
+    const auto& contraction_hierarchy = transport_router_.GetContractionHierarchy();
+    auto& proto_contraction_hierarchy = *proto_main_.mutable_transport_router()->mutable_contraction_hierarchy();
+
+    for(const auto rank : contraction_hierarchy.GetRanks())
+    {
+        proto_contraction_hierarchy.add_ranks(rank);
+    }
+
+    for(const auto& shortcut : contraction_hierarchy.GetShortcuts())
+    {
+        auto& proto_shortcut = *proto_contraction_hierarchy.add_shortcuts();
+        proto_shortcut.set_from(shortcut.from);
+        proto_shortcut.set_to(shortcut.to);
+        proto_shortcut.set_weight(shortcut.weight);
+        proto_shortcut.set_first_edge(shortcut.first_edge);
+        proto_shortcut.set_second_edge(shortcut.second_edge);
+    }
+}
 
 Deserializer::Deserializer(transport::Catalogue& transport_catalogue,
                            transport::renderer::MapRenderer& map_renderer,
@@ -234,61 +348,138 @@ Deserializer::Deserializer(transport::Catalogue& transport_catalogue,
 void Deserializer::operator()(const std::string& file)
 {
     std::ifstream in(file, std::ios::binary);
-    proto_main_.ParseFromIstream(&in);
+    if(!in)
+    {
+        throw std::runtime_error("Can't open base file "s + file);
+    }
+    if(!proto_main_.ParseFromIstream(&in))
+    {
+        throw std::invalid_argument("Broken base file "s + file);
+    }
 
     DeserializationStops();
     DeserializationDistances();
     DeserializationBuses();
+    DeserializationStopIndex();
 
     DeserializationRenderSettings();
+    DeserializationRenderedMap();
 
     DeserializationRouterSettings();
     DeserializationGraph();
     DeserializationVertexIds();
     DeserializationRouteInfo();
+    DeserializationRoutesInternalData();
+    DeserializationContractionHierarchy();
 
     transport_router_.Build();
 }
 
+void Deserializer::DeserializeSettings(std::string_view data)
+{
+    if(!proto_main_.ParseFromArray(data.data(), static_cast<int>(data.size())))
+    {
+        throw std::invalid_argument("Broken settings in the base file");
+    }
+
+    DeserializationRenderSettings();
+    DeserializationRouterSettings();
+}
+
+bool Deserializer::HasNames() const
+{
+    return proto_main_.transport_catalogue().names_size() != 0;
+}
+
+std::string_view Deserializer::DeserializationName(uint32_t name_id) const
+{
+    if(name_id >= static_cast<uint32_t>(proto_main_.transport_catalogue().names_size()))
+    {
+        throw std::out_of_range("Name id is out of range in the base file");
+    }
+
+    return proto_main_.transport_catalogue().names(static_cast<int>(name_id));
+}
+
 void Deserializer::DeserializationStops()
 {
-    for(int i = 0; i < proto_main_.mutable_transport_catalogue()->stops_size(); ++i)
+    const bool has_names = HasNames();
+    for(const auto& proto_stop : proto_main_.transport_catalogue().stops())
     {
-        Stop proto_stop = proto_main_.transport_catalogue().stops(i);
-        transport_catalogue_.AddStop(proto_stop.name(), proto_stop.coordinates().lat(), proto_stop.coordinates().lng());
+        const std::string_view name = has_names ? DeserializationName(proto_stop.name_id()) : proto_stop.name();
+        transport_catalogue_.AddStop(name, proto_stop.coordinates().lat(), proto_stop.coordinates().lng());
     }
 }
 
 void Deserializer::DeserializationDistances()
 {
-    for(int i = 0; i < proto_main_.mutable_transport_catalogue()->distances_size(); ++i)
+    const bool has_names = HasNames();
+    for(const auto& proto_distance : proto_main_.transport_catalogue().distances())
     {
-        std::string stop1 = proto_main_.mutable_transport_catalogue()->distances(i).stop_from();
-        std::string stop2 = proto_main_.mutable_transport_catalogue()->distances(i).stop_to();
-        double distance = proto_main_.mutable_transport_catalogue()->distances(i).distance();
-        transport_catalogue_.AddDistance(stop1, stop2, distance);
+        if(has_names)
+        {
+            transport_catalogue_.AddDistance(proto_distance.stop_from_id(), proto_distance.stop_to_id(), proto_distance.distance());
+        }
+        else
+        {
+            transport_catalogue_.AddDistance(proto_distance.stop_from(), proto_distance.stop_to(), proto_distance.distance());
+        }
     }
 }
 
 void Deserializer::DeserializationBuses()
 {
-    for(int i = 0; i < proto_main_.transport_catalogue().buses_size(); ++i)
+    const bool has_names = HasNames();
+    for(const auto& proto_bus : proto_main_.transport_catalogue().buses())
     {
-        Bus proto_bus = proto_main_.mutable_transport_catalogue()->buses(i);
-
-        const std::string& name = proto_bus.name();
+        const std::string_view name = has_names ? DeserializationName(proto_bus.name_id()) : proto_bus.name();
         bool is_roundtrip = proto_bus.is_roundtrip();
 
-        std::vector<std::string> stops;
-        for(const auto& proto_stop : proto_bus.stops())
+        // В старых базах статистики маршрута нет, её придётся посчитать
+        if(proto_bus.stop_count() == 0)
         {
-            stops.push_back(proto_stop.name());
+            std::vector<std::string> stops;
+            for(const auto& proto_stop : proto_bus.stops())
+            {
+                stops.push_back(proto_stop.name());
+            }
+
+            transport_catalogue_.AddBus(name, stops, is_roundtrip);
+            continue;
         }
 
-        transport_catalogue_.AddBus(name, stops, is_roundtrip);
+        std::vector<domain::StopId> stops;
+        if(has_names)
+        {
+            stops.assign(proto_bus.stop_ids().begin(), proto_bus.stop_ids().end());
+        }
+        else
+        {
+            for(const auto& proto_stop : proto_bus.stops())
+            {
+                stops.push_back(transport_catalogue_.FindStop(proto_stop.name())->id_);
+            }
+        }
+
+        domain::BusInfo bus_info(name, proto_bus.stop_count(), proto_bus.unique_stop_count(), proto_bus.route_length(), proto_bus.curvature());
+        transport_catalogue_.AddBus(name, stops, is_roundtrip, bus_info);
     }
 }
 
+void Deserializer::DeserializationStopIndex()
+{
+    const auto& stop_index = proto_main_.transport_catalogue().stop_index();
+
+    // В старых базах индекса нет, его придётся построить
+    if(static_cast<size_t>(stop_index.size()) != transport_catalogue_.GetStopCount())
+    {
+        transport_catalogue_.BuildStopIndex();
+        return;
+    }
+
+    transport_catalogue_.BuildStopIndex(std::vector<domain::StopId>(stop_index.begin(), stop_index.end()));
+}
+
 void Deserializer::DeserializationRenderSettings()
 {
     RenderSettings proto_render_settings = proto_main_.render_settings();
@@ -324,6 +515,13 @@ void Deserializer::DeserializationRenderSettings()
     map_renderer_.SetSettings(std::move(renderer_settings));
 }
 
+void Deserializer::DeserializationRenderedMap()
+{
+    if(!proto_main_.rendered_map().empty())
+    {
+        map_renderer_.SetRenderedMap(std::move(*proto_main_.mutable_rendered_map()));
+    }
+}
 
 svg::Color Deserializer::DeserializationColor(const Color& proto_color)
 {
@@ -351,42 +549,72 @@ void Deserializer::DeserializationRouterSettings()
     route::Settings route_settings;
     route_settings.bus_wait_time = proto_routing_settings.bus_wait_time();
     route_settings.bus_velocity = proto_routing_settings.bus_velocity();
+    if(proto_routing_settings.walking_velocity() != 0)
+    {
+        route_settings.walking_velocity = proto_routing_settings.walking_velocity();
+    }
+    if(proto_routing_settings.walking_stop_count() != 0)
+    {
+        route_settings.walking_stop_count = proto_routing_settings.walking_stop_count();
+    }
+    switch(proto_routing_settings.router_type())
+    {
+        case RouterType::DIJKSTRA:
+            route_settings.router_type = route::RouterType::DIJKSTRA;
+            break;
+        case RouterType::CONTRACTION_HIERARCHIES:
+            route_settings.router_type = route::RouterType::CONTRACTION_HIERARCHIES;
+            break;
+        case RouterType::PARALLEL_ALL_PAIRS:
+            route_settings.router_type = route::RouterType::PARALLEL_ALL_PAIRS;
+            break;
+        case RouterType::COMPACT_ALL_PAIRS:
+            route_settings.router_type = route::RouterType::COMPACT_ALL_PAIRS;
+            break;
+        default:
+            route_settings.router_type = route::RouterType::ALL_PAIRS;
+            break;
+    }
     transport_router_.SetSettings(route_settings);
 }
 
 void Deserializer::DeserializationGraph()
 {
-    Graph proto_graph = proto_main_.transport_router().graph();
+    const Graph& proto_graph = proto_main_.transport_router().graph();
 
     std::vector<graph::Edge<double>> edges;
-    for(int i = 0; i < proto_graph.edges_size(); ++i)
+    edges.reserve(proto_graph.edges_size());
+    for(const auto& proto_edge : proto_graph.edges())
     {
-        graph::Edge<double> edge{proto_graph.edges(i).from(), proto_graph.edges(i).to(), proto_graph.edges(i).weight()};
-        edges.push_back(edge);
+        edges.push_back({proto_edge.from(), proto_edge.to(), proto_edge.weight()});
     }
 
-    std::vector<std::vector<size_t>> incidence_lists;
-    for(int i = 0; i < proto_graph.incidence_lists_size(); ++i)
+    route::TransportRouter::Graph graph;
+    if(proto_graph.incidence_lists_size() == 0)
+    {
+        graph.SetGraph(proto_graph.vertex_count(), std::move(edges));
+    }
+    else
     {
-        const auto& incidence_list = proto_graph.incidence_lists(i);
-        incidence_lists.emplace_back();
-        for(int j = 0; j < incidence_list.list_size(); ++j)
+        std::vector<std::vector<size_t>> incidence_lists;
+        for(const auto& proto_incidence_list : proto_graph.incidence_lists())
         {
-            incidence_lists[i].push_back(incidence_list.list(j));
+            incidence_lists.emplace_back(proto_incidence_list.list().begin(), proto_incidence_list.list().end());
         }
+        graph.SetGraph(std::move(edges), std::move(incidence_lists));
     }
 
-    route::TransportRouter::Graph graph;
-    graph.SetGraph(edges, incidence_lists);
     transport_router_.SetGraph(std::move(graph));
 }
 
 void Deserializer::DeserializationVertexIds()
 {
     std::unordered_map<std::string_view, route::Vertexe> stop_vertex_ids;
+    const bool has_names = HasNames();
     for(const auto& proto_stop_vertex_id : proto_main_.transport_router().stop_vertex_ids())
     {
-        const domain::Stop* stop = transport_catalogue_.FindStop(proto_stop_vertex_id.name());
+        const domain::Stop* stop = has_names ? transport_catalogue_.FindStop(proto_stop_vertex_id.stop_id())
+                                             : transport_catalogue_.FindStop(proto_stop_vertex_id.name());
         stop_vertex_ids[stop->name_] = {proto_stop_vertex_id.start_wait(), proto_stop_vertex_id.end_wait()};
     }
 
@@ -397,6 +625,7 @@ void Deserializer::DeserializationRouteInfo()
 {
     std::vector<route::EdgeInfo> edges_info;
 
+    const bool has_names = HasNames();
     for(int i = 0; i < proto_main_.transport_router().edges_info_size(); ++i)
     {
         Edge proto_edge = proto_main_.mutable_transport_router()->edges_info(i).edge();
@@ -406,14 +635,16 @@ void Deserializer::DeserializationRouteInfo()
 
         double time = proto_main_.mutable_transport_router()->edges_info(i).time();
 
-        const domain::Stop* stop = transport_catalogue_.FindStop(proto_main_.mutable_transport_router()->edges_info(i).name());
+        const std::string_view name = has_names ? DeserializationName(proto_main_.transport_router().edges_info(i).name_id())
+                                                : proto_main_.transport_router().edges_info(i).name();
+        const domain::Stop* stop = transport_catalogue_.FindStop(name);
         if(stop != nullptr)
         {
             edges_info.push_back({edge, stop->name_, span_count, time});
         }
         else
         {
-            const domain::Bus* bus = transport_catalogue_.FindBus(proto_main_.mutable_transport_router()->edges_info(i).name());
+            const domain::Bus* bus = transport_catalogue_.FindBus(name);
             edges_info.push_back({edge, bus->name_, span_count, time});
         }
     }
@@ -421,4 +652,127 @@ void Deserializer::DeserializationRouteInfo()
     transport_router_.SetEdgesInfo(edges_info);
 }
 
+template <typename StoredWeight, typename StoredEdgeId>
+void Deserializer::DeserializationDenseRoutesInternalData(size_t vertex_count)
+{
+    using DenseRoute = graph::BlockedRouter<double, StoredWeight, StoredEdgeId>;
+
+    const auto& proto_rows = proto_main_.transport_router().routes_internal_data();
+    std::vector<StoredWeight> weights(vertex_count * vertex_count, StoredWeight{});
+    std::vector<StoredEdgeId> prev_edges(vertex_count * vertex_count, DenseRoute::NO_ROUTE);
+    for(size_t vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+    {
+        const auto& proto_row = proto_rows[vertex_from];
+        CheckRoutesInternalDataRow(proto_row, vertex_count);
+        for(int i = 0; i < proto_row.vertex_to_size(); ++i)
+        {
+            const size_t index = vertex_from * vertex_count + proto_row.vertex_to(i);
+            weights[index] = static_cast<StoredWeight>(proto_row.weight(i));
+            prev_edges[index] = proto_row.prev_edge(i) >= 0 ? static_cast<StoredEdgeId>(proto_row.prev_edge(i)) : DenseRoute::NO_EDGE;
+        }
+    }
+
+    transport_router_.SetRoutesInternalData(std::move(weights), std::move(prev_edges));
+}
+
+void Deserializer::CheckRoutesInternalDataRow(const RoutesInternalDataRow& proto_row, size_t vertex_count) const
+{
+    if(proto_row.weight_size() != proto_row.vertex_to_size() || proto_row.prev_edge_size() != proto_row.vertex_to_size())
+    {
+        throw std::invalid_argument("Broken routes internal data in the base file");
+    }
+
+    for(const uint32_t vertex_to : proto_row.vertex_to())
+    {
+        if(vertex_to >= vertex_count)
+        {
+            throw std::invalid_argument("Broken routes internal data in the base file");
+        }
+    }
+
+    // Отрицательный номер означает маршрут из вершины в саму себя
+    const size_t edge_count = transport_router_.GetGraph()->GetEdgeCount();
+    for(const int64_t prev_edge : proto_row.prev_edge())
+    {
+        if(prev_edge >= 0 && static_cast<uint64_t>(prev_edge) >= edge_count)
+        {
+            throw std::invalid_argument("Broken routes internal data in the base file");
+        }
+    }
+}
+
+void Deserializer::DeserializationRoutesInternalData()
+{
+    using RouteInternalData = route::TransportRouter::Route::RouteInternalData;
+
+    const auto& proto_rows = proto_main_.transport_router().routes_internal_data();
+    const size_t vertex_count = proto_rows.size();
+
+    // В базе нет посчитанных маршрутов - роутер посчитает их сам при Build()
+    if(vertex_count == 0)
+    {
+        return;
+    }
+    if(vertex_count != transport_router_.GetGraph()->GetVertexCount())
+    {
+        throw std::invalid_argument("Routes internal data doesn't match the graph in the base file");
+    }
+
+    const route::RouterType router_type = transport_router_.GetSettings().router_type;
+    if(router_type == route::RouterType::PARALLEL_ALL_PAIRS)
+    {
+        DeserializationDenseRoutesInternalData<double, graph::EdgeId>(vertex_count);
+        return;
+    }
+    if(router_type == route::RouterType::COMPACT_ALL_PAIRS)
+    {
+        DeserializationDenseRoutesInternalData<float, uint32_t>(vertex_count);
+        return;
+    }
+
+    route::TransportRouter::Route::RoutesInternalData routes_internal_data(vertex_count, std::vector<std::optional<RouteInternalData>>(vertex_count));
+    for(size_t vertex_from = 0; vertex_from < vertex_count; ++vertex_from)
+    {
+        const auto& proto_row = proto_rows[vertex_from];
+        CheckRoutesInternalDataRow(proto_row, vertex_count);
+        for(int i = 0; i < proto_row.vertex_to_size(); ++i)
+        {
+            std::optional<graph::EdgeId> prev_edge;
+            if(proto_row.prev_edge(i) >= 0)
+            {
+                prev_edge = proto_row.prev_edge(i);
+            }
+
+            routes_internal_data[vertex_from][proto_row.vertex_to(i)] = RouteInternalData{proto_row.weight(i), prev_edge};
+        }
+    }
+
+    transport_router_.SetRoutesInternalData(std::move(routes_internal_data));
+}
+
+void Deserializer::DeserializationContractionHierarchy()
+{
+    if(!proto_main_.transport_router().has_contraction_hierarchy())
+    {
+        return;
+    }
+
+    const auto& proto_contraction_hierarchy = proto_main_.transport_router().contraction_hierarchy();
+
+    std::vector<size_t> ranks(proto_contraction_hierarchy.ranks().begin(), proto_contraction_hierarchy.ranks().end());
+
+    std::vector<route::TransportRouter::HierarchyRoute::Shortcut> shortcuts;
+    shortcuts.reserve(proto_contraction_hierarchy.shortcuts_size());
+    for(const auto& proto_shortcut : proto_contraction_hierarchy.shortcuts())
+    {
+        shortcuts.push_back({proto_shortcut.from(),
+                             proto_shortcut.to(),
+                             proto_shortcut.weight(),
+                             proto_shortcut.first_edge(),
+                             proto_shortcut.second_edge()});
+    }
+
+    transport_router_.SetContractionHierarchy(std::move(ranks), std::move(shortcuts));
+}
+
 } // namespace serialization
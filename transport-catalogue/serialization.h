@@ -13,23 +13,31 @@ public:
     Serializer(transport::Catalogue& transport_catalogue, transport::renderer::MapRenderer& map_renderer, route::TransportRouter& transport_router);
     void operator()(const std::string& file);
 
+    // Только настройки отрисовки и маршрутизации, для плоского формата базы
+    std::string SerializeSettings();
+
 private:
     transport::Catalogue& transport_catalogue_;
     transport::renderer::MapRenderer map_renderer_;
     route::TransportRouter& transport_router_;
     Main proto_main_;
 
+    void SerializationNames();
     void SerializationStops();
     void SerializationDistances();
     void SerializationBuses();
+    void SerializationStopIndex();
 
     void SerializationRenderSettings();
+    void SerializationRenderedMap();
     Color SerializationColor(const svg::Color& color);
 
     void SerializationRouterSettings();
     void SerializationGraph();
     void SerializationVertexIds();
     void SerializationRouteInfo();
+    void SerializationRoutesInternalData();
+    void SerializationContractionHierarchy();
 };
 
 class Deserializer
@@ -38,23 +46,34 @@ public:
     Deserializer(transport::Catalogue& transport_catalogue, transport::renderer::MapRenderer& map_renderer, route::TransportRouter& transport_router);
     void operator()(const std::string& file);
 
+    void DeserializeSettings(std::string_view data);
+
 private:
     transport::Catalogue& transport_catalogue_;
     transport::renderer::MapRenderer& map_renderer_;
     route::TransportRouter& transport_router_;
     Main proto_main_;
 
+    bool HasNames() const;
+    std::string_view DeserializationName(uint32_t name_id) const;
     void DeserializationStops();
     void DeserializationDistances();
     void DeserializationBuses();
+    void DeserializationStopIndex();
 
     void DeserializationRenderSettings();
+    void DeserializationRenderedMap();
     svg::Color DeserializationColor(const Color& proto_color);
 
     void DeserializationRouterSettings();
     void DeserializationGraph();
     void DeserializationVertexIds();
     void DeserializationRouteInfo();
+    void DeserializationRoutesInternalData();
+    void CheckRoutesInternalDataRow(const RoutesInternalDataRow& proto_row, size_t vertex_count) const;
+    template <typename StoredWeight, typename StoredEdgeId>
+    void DeserializationDenseRoutesInternalData(size_t vertex_count);
+    void DeserializationContractionHierarchy();
 };
 
 } // namespace serialization
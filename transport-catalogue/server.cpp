@@ -0,0 +1,569 @@
+#include "server.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <csignal>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace transport::server {
+
+using namespace std::literals;
+
+namespace {
+
+// Номера в epoll_event.data для служебных дескрипторов, соединения нумеруются после них
+const uint64_t LISTEN_ID = 0;
+const uint64_t WAKE_ID = 1;
+const uint64_t SIGNAL_ID = 2;
+const uint64_t FIRST_CONNECTION_ID = 3;
+
+const size_t READ_BLOCK_SIZE = 1 << 16;
+const int MAX_EVENTS = 64;
+// Через сколько миллисекунд снова пробовать принять соединение, если дескрипторы кончились
+const int ACCEPT_RETRY_PERIOD = 100;
+
+// Ограничения на одно соединение. Клиент со слишком длинной строкой отключается,
+// а при большом числе ждущих запросов или неотправленных ответов чтение приостанавливается
+const size_t MAX_LINE_LENGTH = 1 << 20;
+const uint64_t MAX_PENDING_REQUESTS = 1024;
+const size_t MAX_OUTPUT_SIZE = 1 << 24;
+
+[[noreturn]] void ThrowSystemError(const std::string& what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+void AddToEpoll(int epoll_fd, int fd, uint64_t id, uint32_t events)
+{
+    epoll_event event = {};
+    event.events = events;
+    event.data.u64 = id;
+    if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1)
+    {
+        ThrowSystemError("Can't watch descriptor"s);
+    }
+}
+
+} // namespace
+
+Server::Server(std::string socket_path, size_t thread_count, RequestProcessor processor, ReloadHandler reload_handler)
+    : socket_path_(std::move(socket_path)), thread_count_(std::max<size_t>(1, thread_count)), processor_(std::move(processor)),
+      reload_handler_(std::move(reload_handler)), next_connection_id_(FIRST_CONNECTION_ID)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if(socket_path_.empty() || socket_path_.size() >= sizeof(address.sun_path))
+    {
+        throw std::invalid_argument("Bad socket path: "s + socket_path_);
+    }
+    std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size() + 1);
+
+    // Сигналы блокируются до появления сокета: клиент может подключиться и прислать SIGHUP сразу после bind.
+    // Потоки, запущенные позже, наследуют маску, и сигналы получает только signalfd
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    signal_fd_ = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    if(signal_fd_ == -1)
+    {
+        ThrowSystemError("Can't watch signals"s);
+    }
+
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if(listen_fd_ == -1)
+    {
+        const int error = errno;
+        close(signal_fd_);
+        throw std::system_error(error, std::generic_category(), "Can't create socket"s);
+    }
+
+    // Сокет от прошлого запуска мешает bind
+    unlink(socket_path_.c_str());
+    if(bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == -1)
+    {
+        const int error = errno;
+        close(listen_fd_);
+        close(signal_fd_);
+        throw std::system_error(error, std::generic_category(), "Can't bind socket "s + socket_path_);
+    }
+    if(listen(listen_fd_, SOMAXCONN) == -1)
+    {
+        const int error = errno;
+        close(listen_fd_);
+        close(signal_fd_);
+        unlink(socket_path_.c_str());
+        throw std::system_error(error, std::generic_category(), "Can't listen on socket "s + socket_path_);
+    }
+}
+
+Server::~Server()
+{
+    {
+        std::lock_guard guard(jobs_mutex_);
+        is_stopping_ = true;
+    }
+    job_added_.notify_all();
+    reload_requested_.notify_all();
+    for(auto& worker : workers_)
+    {
+        worker.join();
+    }
+    if(reload_thread_.joinable())
+    {
+        reload_thread_.join();
+    }
+
+    for(const auto& [id, connection] : connections_)
+    {
+        close(connection.fd);
+    }
+    for(const int fd : {signal_fd_, wake_fd_, epoll_fd_, listen_fd_})
+    {
+        if(fd != -1)
+        {
+            close(fd);
+        }
+    }
+
+    unlink(socket_path_.c_str());
+}
+
+void Server::Run()
+{
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if(wake_fd_ == -1 || epoll_fd_ == -1)
+    {
+        ThrowSystemError("Can't start server"s);
+    }
+
+    AddToEpoll(epoll_fd_, listen_fd_, LISTEN_ID, EPOLLIN);
+    AddToEpoll(epoll_fd_, wake_fd_, WAKE_ID, EPOLLIN);
+    AddToEpoll(epoll_fd_, signal_fd_, SIGNAL_ID, EPOLLIN);
+
+    workers_.reserve(thread_count_);
+    for(size_t i = 0; i < thread_count_; ++i)
+    {
+        workers_.emplace_back([this] { WorkerLoop(); });
+    }
+    if(reload_handler_)
+    {
+        reload_thread_ = std::thread([this] { ReloadLoop(); });
+    }
+
+    epoll_event events[MAX_EVENTS];
+    while(true)
+    {
+        const int event_count = epoll_wait(epoll_fd_, events, MAX_EVENTS, is_accept_paused_ ? ACCEPT_RETRY_PERIOD : -1);
+        if(event_count == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            ThrowSystemError("Can't wait for events"s);
+        }
+        if(event_count == 0)
+        {
+            ResumeAccepting();
+            continue;
+        }
+
+        for(int i = 0; i < event_count; ++i)
+        {
+            const uint64_t id = events[i].data.u64;
+            if(id == LISTEN_ID)
+            {
+                AcceptConnections();
+            }
+            else if(id == WAKE_ID)
+            {
+                CollectResults();
+            }
+            else if(id == SIGNAL_ID)
+            {
+                if(!HandleSignals())
+                {
+                    return;
+                }
+            }
+            else
+            {
+                if(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                {
+                    ReadRequests(id);
+                }
+                if(events[i].events & EPOLLOUT)
+                {
+                    WriteResponses(id);
+                }
+            }
+        }
+    }
+}
+
+void Server::WorkerLoop()
+{
+    while(true)
+    {
+        Job job;
+        {
+            std::unique_lock lock(jobs_mutex_);
+            job_added_.wait(lock, [this] { return is_stopping_ || !jobs_.empty(); });
+            if(is_stopping_)
+            {
+                return;
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+
+        Result result{job.connection_id, job.request_id, processor_(job.request)};
+        {
+            std::lock_guard guard(results_mutex_);
+            results_.push_back(std::move(result));
+        }
+
+        const uint64_t one = 1;
+        [[maybe_unused]] const ssize_t written = write(wake_fd_, &one, sizeof(one));
+    }
+}
+
+void Server::ReloadLoop()
+{
+    while(true)
+    {
+        {
+            std::unique_lock lock(jobs_mutex_);
+            reload_requested_.wait(lock, [this] { return is_stopping_ || is_reload_requested_; });
+            if(is_stopping_)
+            {
+                return;
+            }
+            is_reload_requested_ = false;
+        }
+
+        reload_handler_();
+    }
+}
+
+bool Server::HandleSignals()
+{
+    signalfd_siginfo info = {};
+    while(read(signal_fd_, &info, sizeof(info)) == sizeof(info))
+    {
+        if(info.ssi_signo != SIGHUP)
+        {
+            return false;
+        }
+
+        if(reload_handler_)
+        {
+            {
+                std::lock_guard guard(jobs_mutex_);
+                is_reload_requested_ = true;
+            }
+            reload_requested_.notify_one();
+        }
+    }
+
+    return true;
+}
+
+void Server::AcceptConnections()
+{
+    while(true)
+    {
+        const int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if(fd == -1)
+        {
+            if(errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            if(errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return;
+            }
+            if(errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+            {
+                PauseAccepting();
+                return;
+            }
+            ThrowSystemError("Can't accept connection"s);
+        }
+
+        const uint64_t id = next_connection_id_++;
+        AddToEpoll(epoll_fd_, fd, id, EPOLLIN);
+        Connection& connection = connections_[id];
+        connection.fd = fd;
+        connection.events = EPOLLIN;
+    }
+}
+
+void Server::PauseAccepting()
+{
+    if(is_accept_paused_)
+    {
+        return;
+    }
+    if(epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, listen_fd_, nullptr) == -1)
+    {
+        ThrowSystemError("Can't stop watching socket"s);
+    }
+    is_accept_paused_ = true;
+}
+
+void Server::ResumeAccepting()
+{
+    if(!is_accept_paused_)
+    {
+        return;
+    }
+    AddToEpoll(epoll_fd_, listen_fd_, LISTEN_ID, EPOLLIN);
+    is_accept_paused_ = false;
+}
+
+void Server::ReadRequests(uint64_t connection_id)
+{
+    const auto it = connections_.find(connection_id);
+    if(it == connections_.end())
+    {
+        return;
+    }
+    Connection& connection = it->second;
+
+    // Ввод читается порциями не больше самой длинной строки, остальное подождёт в сокете
+    char block[READ_BLOCK_SIZE];
+    while(!connection.is_input_closed && connection.input.size() <= MAX_LINE_LENGTH)
+    {
+        const ssize_t size = read(connection.fd, block, sizeof(block));
+        if(size > 0)
+        {
+            connection.input.append(block, size);
+            continue;
+        }
+        if(size == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        if(size == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        if(size == -1)
+        {
+            CloseConnection(connection_id);
+            return;
+        }
+
+        // Клиент закрыл свою сторону; последняя строка может быть без перевода строки
+        connection.is_input_closed = true;
+        if(!connection.input.empty() && connection.input.back() != '\n')
+        {
+            connection.input.push_back('\n');
+        }
+    }
+
+    UpdateConnection(connection_id);
+}
+
+void Server::CollectResults()
+{
+    uint64_t counter = 0;
+    [[maybe_unused]] const ssize_t size = read(wake_fd_, &counter, sizeof(counter));
+
+    std::vector<Result> results;
+    {
+        std::lock_guard guard(results_mutex_);
+        results.swap(results_);
+    }
+
+    std::vector<uint64_t> updated_connections;
+    for(Result& result : results)
+    {
+        const auto it = connections_.find(result.connection_id);
+        if(it == connections_.end())
+        {
+            // Клиент уже отключился
+            continue;
+        }
+
+        Connection& connection = it->second;
+        connection.ready_responses.emplace(result.request_id, std::move(result.response));
+        for(auto ready = connection.ready_responses.begin();
+            ready != connection.ready_responses.end() && ready->first == connection.next_response;
+            ready = connection.ready_responses.erase(ready))
+        {
+            connection.output += ready->second;
+            connection.output += '\n';
+            ++connection.next_response;
+        }
+        updated_connections.push_back(result.connection_id);
+    }
+
+    std::sort(updated_connections.begin(), updated_connections.end());
+    updated_connections.erase(std::unique(updated_connections.begin(), updated_connections.end()), updated_connections.end());
+    for(const uint64_t connection_id : updated_connections)
+    {
+        WriteResponses(connection_id);
+    }
+}
+
+void Server::WriteResponses(uint64_t connection_id)
+{
+    const auto it = connections_.find(connection_id);
+    if(it == connections_.end())
+    {
+        return;
+    }
+    Connection& connection = it->second;
+
+    size_t sent = 0;
+    while(sent < connection.output.size())
+    {
+        const ssize_t size = send(connection.fd, connection.output.data() + sent, connection.output.size() - sent, MSG_NOSIGNAL);
+        if(size >= 0)
+        {
+            sent += size;
+            continue;
+        }
+        if(errno == EINTR)
+        {
+            continue;
+        }
+        if(errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            break;
+        }
+
+        CloseConnection(connection_id);
+        return;
+    }
+    connection.output.erase(0, sent);
+
+    UpdateConnection(connection_id);
+}
+
+void Server::UpdateConnection(uint64_t connection_id)
+{
+    Connection& connection = connections_.at(connection_id);
+    if(!EnqueueRequests(connection_id, connection))
+    {
+        CloseConnection(connection_id);
+        return;
+    }
+
+    if(connection.is_input_closed && connection.input.empty() && connection.next_response == connection.next_request
+       && connection.output.empty())
+    {
+        CloseConnection(connection_id);
+        return;
+    }
+
+    // Пока клиент не забирает ответы или ждёт слишком много запросов, новые запросы не читаются.
+    // Остаток вывода отправится, когда сокет снова будет готов к записи
+    uint32_t events = 0;
+    if(!connection.is_input_closed && !IsBusy(connection))
+    {
+        events |= EPOLLIN;
+    }
+    if(!connection.output.empty())
+    {
+        events |= EPOLLOUT;
+    }
+    if(events == connection.events)
+    {
+        return;
+    }
+
+    // Дескриптор без нужных событий снимается с epoll, иначе EPOLLHUP приходил бы постоянно
+    epoll_event event = {};
+    event.events = events;
+    event.data.u64 = connection_id;
+    const int operation = connection.events == 0 ? EPOLL_CTL_ADD : (events == 0 ? EPOLL_CTL_DEL : EPOLL_CTL_MOD);
+    epoll_ctl(epoll_fd_, operation, connection.fd, operation == EPOLL_CTL_DEL ? nullptr : &event);
+    connection.events = events;
+}
+
+bool Server::EnqueueRequests(uint64_t connection_id, Connection& connection)
+{
+    size_t begin = 0;
+    std::vector<Job> jobs;
+    while(!IsBusy(connection))
+    {
+        const size_t end = connection.input.find('\n', begin);
+        if(end == std::string::npos)
+        {
+            if(connection.input.size() - begin > MAX_LINE_LENGTH)
+            {
+                return false;
+            }
+            break;
+        }
+        if(end - begin > MAX_LINE_LENGTH)
+        {
+            return false;
+        }
+
+        const std::string_view line = std::string_view(connection.input).substr(begin, end - begin);
+        begin = end + 1;
+        if(line.find_first_not_of(" \t\r"sv) == std::string_view::npos)
+        {
+            continue;
+        }
+
+        jobs.push_back({connection_id, connection.next_request++, std::string(line)});
+    }
+    connection.input.erase(0, begin);
+
+    if(!jobs.empty())
+    {
+        {
+            std::lock_guard guard(jobs_mutex_);
+            std::move(jobs.begin(), jobs.end(), std::back_inserter(jobs_));
+        }
+        job_added_.notify_all();
+    }
+
+    return true;
+}
+
+bool Server::IsBusy(const Connection& connection)
+{
+    return connection.next_request - connection.next_response >= MAX_PENDING_REQUESTS || connection.output.size() >= MAX_OUTPUT_SIZE;
+}
+
+void Server::CloseConnection(uint64_t connection_id)
+{
+    const auto it = connections_.find(connection_id);
+    if(it == connections_.end())
+    {
+        return;
+    }
+
+    // close снимает дескриптор с epoll
+    close(it->second.fd);
+    connections_.erase(it);
+
+    // Освободился дескриптор - можно снова принимать соединения
+    ResumeAccepting();
+}
+
+} // namespace transport::server
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace transport::server {
+
+// Сервер на Unix-сокете: клиент присылает по одному запросу в строке и получает по строке ответа
+// на каждый запрос в том же порядке. Ввод-вывод всех соединений ведёт один поток на epoll,
+// запросы выполняются в пуле рабочих потоков. Run работает до SIGINT или SIGTERM,
+// по SIGHUP в отдельном потоке вызывается обработчик перезагрузки.
+// Конструктор блокирует эти сигналы в вызывающем потоке ещё до bind, поэтому сервер создают до запуска других потоков
+class Server
+{
+public:
+    // Вызывается из рабочих потоков одновременно и не должен выбрасывать исключения
+    using RequestProcessor = std::function<std::string(std::string_view request)>;
+    // Выполняется одновременно с запросами и тоже не должен выбрасывать исключения.
+    // Сигналы, пришедшие во время перезагрузки, объединяются в одну следующую
+    using ReloadHandler = std::function<void()>;
+
+    Server(std::string socket_path, size_t thread_count, RequestProcessor processor, ReloadHandler reload_handler = {});
+    ~Server();
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    void Run();
+
+private:
+    struct Connection
+    {
+        int fd = -1;
+        std::string input;
+        std::string output;
+        // Номер следующего прочитанного запроса и следующего ответа, который пора отправить
+        uint64_t next_request = 0;
+        uint64_t next_response = 0;
+        // Ответы, готовые раньше предыдущих
+        std::map<uint64_t, std::string> ready_responses;
+        bool is_input_closed = false;
+        // События, на которые дескриптор подписан в epoll; 0 - дескриптор снят с epoll
+        uint32_t events = 0;
+    };
+
+    struct Job
+    {
+        uint64_t connection_id;
+        uint64_t request_id;
+        std::string request;
+    };
+
+    struct Result
+    {
+        uint64_t connection_id;
+        uint64_t request_id;
+        std::string response;
+    };
+
+    void WorkerLoop();
+    void ReloadLoop();
+    // Возвращает false, если пришёл сигнал остановки
+    bool HandleSignals();
+
+    void AcceptConnections();
+    // Пока не хватает дескрипторов, слушающий сокет снимается с epoll, иначе epoll будит цикл на нём без конца.
+    // Приём возобновляется при закрытии соединения или через короткую паузу
+    void PauseAccepting();
+    void ResumeAccepting();
+    void ReadRequests(uint64_t connection_id);
+    void CollectResults();
+    void WriteResponses(uint64_t connection_id);
+    // Ставит в очередь прочитанные запросы, подписывает дескриптор на нужные события
+    // и закрывает соединение, когда всё отправлено или клиент нарушил ограничения
+    void UpdateConnection(uint64_t connection_id);
+    // Возвращает false, если строка запроса длиннее допустимой
+    bool EnqueueRequests(uint64_t connection_id, Connection& connection);
+    static bool IsBusy(const Connection& connection);
+    void CloseConnection(uint64_t connection_id);
+
+    std::string socket_path_;
+    size_t thread_count_;
+    RequestProcessor processor_;
+    ReloadHandler reload_handler_;
+
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+    // Рабочие потоки будят цикл ввода-вывода через eventfd, сигналы приходят через signalfd
+    int wake_fd_ = -1;
+    int signal_fd_ = -1;
+    bool is_accept_paused_ = false;
+
+    std::unordered_map<uint64_t, Connection> connections_;
+    uint64_t next_connection_id_;
+
+    std::mutex jobs_mutex_;
+    std::condition_variable job_added_;
+    std::deque<Job> jobs_;
+    bool is_stopping_ = false;
+    std::condition_variable reload_requested_;
+    bool is_reload_requested_ = false;
+
+    std::mutex results_mutex_;
+    std::vector<Result> results_;
+
+    std::vector<std::thread> workers_;
+    std::thread reload_thread_;
+};
+
+} // namespace transport::server
@@ -0,0 +1,327 @@
+#include "spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+namespace geo {
+
+namespace {
+
+// Запас для верхней оценки косинуса по прямоугольнику: оценка и косинусы точек считаются разными выражениями,
+// и без запаса округление могло бы поставить точку впереди оценки её узла
+const double BOX_COSINE_SLACK = 1e-14;
+
+SpatialIndex::Box MakeBox(Coordinates point)
+{
+    return {point.lat, point.lng, point.lat, point.lng};
+}
+
+void ExtendBox(SpatialIndex::Box& box, const SpatialIndex::Box& other)
+{
+    box.min_lat = std::min(box.min_lat, other.min_lat);
+    box.min_lng = std::min(box.min_lng, other.min_lng);
+    box.max_lat = std::max(box.max_lat, other.max_lat);
+    box.max_lng = std::max(box.max_lng, other.max_lng);
+}
+
+bool IsIntersected(const SpatialIndex::Box& lhs, const SpatialIndex::Box& rhs)
+{
+    return lhs.min_lat <= rhs.max_lat && rhs.min_lat <= lhs.max_lat
+           && lhs.min_lng <= rhs.max_lng && rhs.min_lng <= lhs.max_lng;
+}
+
+bool IsInside(Coordinates point, const SpatialIndex::Box& box)
+{
+    return point.lat >= box.min_lat && point.lat <= box.max_lat
+           && point.lng >= box.min_lng && point.lng <= box.max_lng;
+}
+
+} // namespace
+
+void SpatialIndex::Build(const std::vector<Coordinates>& points)
+{
+    std::vector<uint32_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    const auto by_lng = [&points](uint32_t lhs, uint32_t rhs)
+    {
+        return std::tie(points[lhs].lng, points[lhs].lat, lhs) < std::tie(points[rhs].lng, points[rhs].lat, rhs);
+    };
+    const auto by_lat = [&points](uint32_t lhs, uint32_t rhs)
+    {
+        return std::tie(points[lhs].lat, points[lhs].lng, lhs) < std::tie(points[rhs].lat, points[rhs].lng, rhs);
+    };
+
+    // Полосы по долготе примерно из sqrt(число листьев) листьев каждая
+    const size_t leaf_count = (points.size() + NODE_SIZE - 1) / NODE_SIZE;
+    const size_t slice_size = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leaf_count)))) * NODE_SIZE;
+
+    std::sort(order.begin(), order.end(), by_lng);
+    for(size_t begin = 0; begin < order.size(); begin += slice_size)
+    {
+        const size_t end = std::min(order.size(), begin + slice_size);
+        std::sort(order.begin() + begin, order.begin() + end, by_lat);
+    }
+
+    Build(points, std::move(order));
+}
+
+void SpatialIndex::Build(const std::vector<Coordinates>& points, std::vector<uint32_t> order)
+{
+    if(order.size() != points.size())
+    {
+        throw std::invalid_argument("Spatial index order doesn't match the points");
+    }
+
+    std::vector<bool> is_used(points.size(), false);
+    points_.clear();
+    points_.reserve(points.size());
+    for(const uint32_t id : order)
+    {
+        if(id >= points.size() || is_used[id])
+        {
+            throw std::invalid_argument("Spatial index order doesn't match the points");
+        }
+
+        is_used[id] = true;
+        points_.push_back(points[id]);
+    }
+
+    order_ = std::move(order);
+    BuildNodes();
+}
+
+void SpatialIndex::BuildNodes()
+{
+    boxes_.clear();
+    level_starts_.clear();
+    if(points_.empty())
+    {
+        return;
+    }
+
+    level_starts_.push_back(0);
+    for(size_t begin = 0; begin < points_.size(); begin += NODE_SIZE)
+    {
+        Box box = MakeBox(points_[begin]);
+        for(size_t i = begin + 1; i < std::min(points_.size(), begin + NODE_SIZE); ++i)
+        {
+            ExtendBox(box, MakeBox(points_[i]));
+        }
+        boxes_.push_back(box);
+    }
+
+    size_t level_begin = 0;
+    size_t level_end = boxes_.size();
+    while(level_end - level_begin > 1)
+    {
+        level_starts_.push_back(level_end);
+        for(size_t begin = level_begin; begin < level_end; begin += NODE_SIZE)
+        {
+            Box box = boxes_[begin];
+            for(size_t i = begin + 1; i < std::min(level_end, begin + NODE_SIZE); ++i)
+            {
+                ExtendBox(box, boxes_[i]);
+            }
+            boxes_.push_back(box);
+        }
+
+        level_begin = level_end;
+        level_end = boxes_.size();
+    }
+
+    level_starts_.push_back(boxes_.size());
+
+    points_lat_.clear();
+    points_lng_.clear();
+    points_lat_.reserve(points_.size());
+    points_lng_.reserve(points_.size());
+    for(const auto& point : points_)
+    {
+        points_lat_.push_back(ComputeTrig(point.lat));
+        points_lng_.push_back(ComputeTrig(point.lng));
+    }
+
+    boxes_trig_.clear();
+    boxes_trig_.reserve(boxes_.size());
+    for(const auto& box : boxes_)
+    {
+        boxes_trig_.push_back({ComputeTrig(box.min_lat), ComputeTrig(box.min_lng), ComputeTrig(box.max_lat), ComputeTrig(box.max_lng)});
+    }
+}
+
+SpatialIndex::Trig SpatialIndex::ComputeTrig(double degrees)
+{
+    return {std::sin(degrees * DR), std::cos(degrees * DR)};
+}
+
+const std::vector<uint32_t>& SpatialIndex::GetOrder() const
+{
+    return order_;
+}
+
+size_t SpatialIndex::GetSize() const
+{
+    return order_.size();
+}
+
+std::vector<SpatialIndex::Neighbour> SpatialIndex::FindNearest(Coordinates point, size_t count) const
+{
+    std::vector<Neighbour> result;
+    if(boxes_.empty() || count == 0)
+    {
+        return result;
+    }
+
+    // Обход по убыванию верхней оценки косинуса, то есть по возрастанию нижней оценки расстояния:
+    // точка, вынутая из очереди, ближе всего, что в ней осталось. level == -1 у точек, у узлов - номер уровня
+    struct Entry
+    {
+        double cosine;
+        size_t index;
+        int level;
+
+        bool operator<(const Entry& other) const
+        {
+            return cosine < other.cosine;
+        }
+    };
+
+    const Query query = {point, ComputeTrig(point.lat), ComputeTrig(point.lng)};
+
+    std::priority_queue<Entry> queue;
+    queue.push({1.0, boxes_.size() - 1, static_cast<int>(level_starts_.size()) - 2});
+
+    while(!queue.empty() && result.size() < count)
+    {
+        const Entry entry = queue.top();
+        queue.pop();
+
+        if(entry.level < 0)
+        {
+            result.push_back({order_[entry.index], ComputePointDistance(query, entry.index)});
+            continue;
+        }
+
+        const size_t first_child = (entry.index - level_starts_[entry.level]) * NODE_SIZE;
+        if(entry.level == 0)
+        {
+            for(size_t i = first_child; i < std::min(points_.size(), first_child + NODE_SIZE); ++i)
+            {
+                queue.push({ComputePointCosine(query, i), i, -1});
+            }
+        }
+        else
+        {
+            const size_t children_begin = level_starts_[entry.level - 1] + first_child;
+            const size_t children_end = std::min(level_starts_[entry.level], children_begin + NODE_SIZE);
+            for(size_t i = children_begin; i < children_end; ++i)
+            {
+                queue.push({ComputeBoxCosine(query, i), i, entry.level - 1});
+            }
+        }
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> SpatialIndex::FindInBox(const Box& box) const
+{
+    std::vector<uint32_t> result;
+    if(boxes_.empty())
+    {
+        return result;
+    }
+
+    std::vector<std::pair<size_t, size_t>> stack = {{boxes_.size() - 1, level_starts_.size() - 2}};
+    while(!stack.empty())
+    {
+        const auto [index, level] = stack.back();
+        stack.pop_back();
+
+        if(!IsIntersected(boxes_[index], box))
+        {
+            continue;
+        }
+
+        const size_t first_child = (index - level_starts_[level]) * NODE_SIZE;
+        if(level == 0)
+        {
+            for(size_t i = first_child; i < std::min(points_.size(), first_child + NODE_SIZE); ++i)
+            {
+                if(IsInside(points_[i], box))
+                {
+                    result.push_back(order_[i]);
+                }
+            }
+        }
+        else
+        {
+            const size_t children_begin = level_starts_[level - 1] + first_child;
+            const size_t children_end = std::min(level_starts_[level], children_begin + NODE_SIZE);
+            for(size_t i = children_begin; i < children_end; ++i)
+            {
+                stack.push_back({i, level - 1});
+            }
+        }
+    }
+
+    return result;
+}
+
+// Косинус разности долгот раскладывается по формуле косинуса разности
+double SpatialIndex::ComputePointCosine(const Query& query, size_t index) const
+{
+    const double cos_lng_delta = query.lng.cos * points_lng_[index].cos + query.lng.sin * points_lng_[index].sin;
+    return query.lat.sin * points_lat_[index].sin + query.lat.cos * points_lat_[index].cos * cos_lng_delta;
+}
+
+// Верхняя оценка косинуса центрального угла между точкой и прямоугольником. Если точка в полосе долгот прямоугольника,
+// ближайшая точка прямоугольника на том же меридиане, иначе на ближнем боковом меридиане - у него косинус разности долгот больше.
+// На меридиане косинус s * sin(lat) + c * cos(lat) наибольший на концах отрезка широт
+// или в точке tg(lat) = s / c, если она внутри отрезка, и тогда он равен sqrt(s^2 + c^2)
+double SpatialIndex::ComputeBoxCosine(const Query& query, size_t index) const
+{
+    const Box& box = boxes_[index];
+    const BoxTrig& trig = boxes_trig_[index];
+
+    double cos_lng_delta = 1.0;
+    if(query.point.lng < box.min_lng || query.point.lng > box.max_lng)
+    {
+        cos_lng_delta = std::max(query.lng.cos * trig.min_lng.cos + query.lng.sin * trig.min_lng.sin,
+                                 query.lng.cos * trig.max_lng.cos + query.lng.sin * trig.max_lng.sin);
+    }
+
+    const double s = query.lat.sin;
+    const double c = query.lat.cos * cos_lng_delta;
+
+    double cosine = std::max(s * trig.min_lat.sin + c * trig.min_lat.cos,
+                             s * trig.max_lat.sin + c * trig.max_lat.cos);
+    if(c > 0 && trig.min_lat.sin * c < s * trig.min_lat.cos && s * trig.max_lat.cos < trig.max_lat.sin * c)
+    {
+        cosine = std::sqrt(s * s + c * c);
+    }
+
+    return cosine + BOX_COSINE_SLACK;
+}
+
+// То же, что geo::ComputeDistance, но с заранее посчитанными синусами и косинусами широт
+double SpatialIndex::ComputePointDistance(const Query& query, size_t index) const
+{
+    const Coordinates& point = points_[index];
+    if(query.point == point)
+    {
+        return 0;
+    }
+
+    return std::acos(query.lat.sin * points_lat_[index].sin
+                     + query.lat.cos * points_lat_[index].cos
+                     * std::cos(std::abs(query.point.lng - point.lng) * DR))
+                     * RADIUS_EARTH;
+}
+
+} // namespace geo
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "geo.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geo {
+
+// Статическое упакованное R-дерево над точками. Точки раскладываются по листьям методом STR
+// (полосы по долготе, внутри полосы по широте), по NODE_SIZE точек в листе и по NODE_SIZE детей в узле.
+// Всё дерево описывается порядком точек: прямоугольники узлов восстанавливаются из него за один линейный проход,
+// поэтому в базе хранится только этот порядок
+class SpatialIndex
+{
+public:
+    static constexpr size_t NODE_SIZE = 16;
+
+    struct Box
+    {
+        double min_lat;
+        double min_lng;
+        double max_lat;
+        double max_lng;
+    };
+
+    struct Neighbour
+    {
+        uint32_t id;
+        double distance;
+    };
+
+    // Номер точки - её индекс в points
+    void Build(const std::vector<Coordinates>& points);
+    // Дерево с уже известным порядком точек, например из файла базы
+    void Build(const std::vector<Coordinates>& points, std::vector<uint32_t> order);
+
+    const std::vector<uint32_t>& GetOrder() const;
+    size_t GetSize() const;
+
+    // count ближайших к point точек по расстоянию на поверхности Земли, по возрастанию расстояния
+    std::vector<Neighbour> FindNearest(Coordinates point, size_t count) const;
+    // Точки внутри прямоугольника, границы включаются
+    std::vector<uint32_t> FindInBox(const Box& box) const;
+
+private:
+    // Синус и косинус угла в градусах
+    struct Trig
+    {
+        double sin;
+        double cos;
+    };
+
+    struct BoxTrig
+    {
+        Trig min_lat;
+        Trig min_lng;
+        Trig max_lat;
+        Trig max_lng;
+    };
+
+    struct Query
+    {
+        Coordinates point;
+        Trig lat;
+        Trig lng;
+    };
+
+    static Trig ComputeTrig(double degrees);
+
+    void BuildNodes();
+    // Поиск ближайших упорядочен по косинусу центрального угла: он убывает с расстоянием,
+    // а с заранее посчитанными синусами и косинусами считается без тригонометрии
+    double ComputePointCosine(const Query& query, size_t index) const;
+    double ComputeBoxCosine(const Query& query, size_t index) const;
+    double ComputePointDistance(const Query& query, size_t index) const;
+
+    std::vector<uint32_t> order_;
+    std::vector<Coordinates> points_;
+    std::vector<Trig> points_lat_;
+    std::vector<Trig> points_lng_;
+    // Узлы всех уровней подряд, от листьев к корню; level_starts_[level] - первый узел уровня
+    std::vector<Box> boxes_;
+    std::vector<BoxTrig> boxes_trig_;
+    std::vector<size_t> level_starts_;
+};
+
+} // namespace geo
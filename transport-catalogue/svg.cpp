@@ -1,5 +1,6 @@
 #include "svg.h"
 #include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <utility>
 
@@ -239,6 +240,249 @@ void Document::Render(std::ostream& out) const
     out << "</svg>"sv;
 }
 
+// ---------- StreamWriter --------------------
+
+StreamWriter::StreamWriter(std::string& buffer) : buffer_(buffer)
+{
+}
+
+void StreamWriter::BeginDocument()
+{
+    Write("<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"sv);
+    Write("<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\">\n"sv);
+}
+
+void StreamWriter::EndDocument()
+{
+    Write("</svg>"sv);
+}
+
+void StreamWriter::WriteCircle(Point center, double radius, const PathAttrs& attrs)
+{
+    Write("  <circle cx=\""sv);
+    Write(center.x);
+    Write("\" cy=\""sv);
+    Write(center.y);
+    Write("\" r=\""sv);
+    Write(radius);
+    Write("\""sv);
+    WritePathAttrs(attrs);
+    Write("/>\n"sv);
+}
+
+void StreamWriter::BeginPolyline()
+{
+    Write("  <polyline points=\""sv);
+    is_first_point_ = true;
+}
+
+void StreamWriter::AddPolylinePoint(Point point)
+{
+    if(!is_first_point_)
+    {
+        Write(" "sv);
+    }
+    is_first_point_ = false;
+
+    Write(point.x);
+    Write(","sv);
+    Write(point.y);
+}
+
+void StreamWriter::EndPolyline(const PathAttrs& attrs)
+{
+    Write("\""sv);
+    WritePathAttrs(attrs);
+    Write("/>\n"sv);
+}
+
+void StreamWriter::WriteText(Point position, std::string_view data, const TextAttrs& text_attrs, const PathAttrs& attrs)
+{
+    Write("  <text"sv);
+    WritePathAttrs(attrs);
+    Write(" x=\""sv);
+    Write(position.x);
+    Write("\" y=\""sv);
+    Write(position.y);
+    Write("\" dx=\""sv);
+    Write(text_attrs.offset.x);
+    Write("\" dy=\""sv);
+    Write(text_attrs.offset.y);
+    Write("\" font-size=\""sv);
+    Write(text_attrs.font_size);
+    Write("\" "sv);
+    if(!text_attrs.font_family.empty())
+    {
+        Write("font-family=\""sv);
+        Write(text_attrs.font_family);
+        Write("\""sv);
+    }
+    if(!text_attrs.font_family.empty() && !text_attrs.font_weight.empty())
+    {
+        Write(" "sv);
+    }
+    if(!text_attrs.font_weight.empty())
+    {
+        Write("font-weight=\""sv);
+        Write(text_attrs.font_weight);
+        Write("\""sv);
+    }
+    Write(">"sv);
+    WriteEscaped(data);
+    Write("</text>\n"sv);
+}
+
+void StreamWriter::Write(std::string_view text)
+{
+    buffer_.append(text);
+}
+
+void StreamWriter::Write(double value)
+{
+    // Шесть значащих цифр в общем формате - как у потока по умолчанию
+    char digits[32];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, 6);
+    buffer_.append(digits, result.ptr);
+}
+
+void StreamWriter::Write(uint32_t value)
+{
+    char digits[16];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    buffer_.append(digits, result.ptr);
+}
+
+void StreamWriter::Write(const Color& color)
+{
+    if(std::holds_alternative<std::monostate>(color))
+    {
+        Write("none"sv);
+    }
+    else if(const auto* name = std::get_if<std::string>(&color))
+    {
+        Write(std::string_view(*name));
+    }
+    else if(const auto* rgb = std::get_if<Rgb>(&color))
+    {
+        Write("rgb("sv);
+        Write(static_cast<uint32_t>(rgb->red));
+        Write(","sv);
+        Write(static_cast<uint32_t>(rgb->green));
+        Write(","sv);
+        Write(static_cast<uint32_t>(rgb->blue));
+        Write(")"sv);
+    }
+    else if(const auto* rgba = std::get_if<Rgba>(&color))
+    {
+        Write("rgba("sv);
+        Write(static_cast<uint32_t>(rgba->red));
+        Write(","sv);
+        Write(static_cast<uint32_t>(rgba->green));
+        Write(","sv);
+        Write(static_cast<uint32_t>(rgba->blue));
+        Write(","sv);
+        Write(rgba->opacity);
+        Write(")"sv);
+    }
+}
+
+void StreamWriter::WriteEscaped(std::string_view text)
+{
+    // Участки без спецсимволов копируются целиком
+    size_t begin = 0;
+    for(size_t i = 0; i < text.size(); ++i)
+    {
+        std::string_view escaped;
+        switch(text[i])
+        {
+            case '"':
+                escaped = "&quot;"sv;
+                break;
+            case '\'':
+                escaped = "&apos;"sv;
+                break;
+            case '<':
+                escaped = "&lt;"sv;
+                break;
+            case '>':
+                escaped = "&gt;"sv;
+                break;
+            case '&':
+                escaped = "&amp;"sv;
+                break;
+            default:
+                continue;
+        }
+
+        buffer_.append(text.data() + begin, i - begin);
+        Write(escaped);
+        begin = i + 1;
+    }
+    buffer_.append(text.data() + begin, text.size() - begin);
+}
+
+void StreamWriter::WritePathAttrs(const PathAttrs& attrs)
+{
+    if(attrs.fill_color)
+    {
+        Write(" fill=\""sv);
+        Write(*attrs.fill_color);
+        Write("\""sv);
+    }
+    if(attrs.stroke_color)
+    {
+        Write(" stroke=\""sv);
+        Write(*attrs.stroke_color);
+        Write("\""sv);
+    }
+    if(attrs.stroke_width)
+    {
+        Write(" stroke-width=\""sv);
+        Write(*attrs.stroke_width);
+        Write("\""sv);
+    }
+    if(attrs.stroke_line_cap)
+    {
+        Write(" stroke-linecap=\""sv);
+        switch(*attrs.stroke_line_cap)
+        {
+            case StrokeLineCap::BUTT:
+                Write("butt"sv);
+                break;
+            case StrokeLineCap::ROUND:
+                Write("round"sv);
+                break;
+            case StrokeLineCap::SQUARE:
+                Write("square"sv);
+                break;
+        }
+        Write("\""sv);
+    }
+    if(attrs.stroke_line_join)
+    {
+        Write(" stroke-linejoin=\""sv);
+        switch(*attrs.stroke_line_join)
+        {
+            case StrokeLineJoin::ARCS:
+                Write("arcs"sv);
+                break;
+            case StrokeLineJoin::BEVEL:
+                Write("bevel"sv);
+                break;
+            case StrokeLineJoin::MITER:
+                Write("miter"sv);
+                break;
+            case StrokeLineJoin::MITER_CLIP:
+                Write("miter-clip"sv);
+                break;
+            case StrokeLineJoin::ROUND:
+                Write("round"sv);
+                break;
+        }
+        Write("\""sv);
+    }
+}
+
 }  // namespace svg
 
 
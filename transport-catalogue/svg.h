@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 #include <variant>
@@ -306,6 +307,59 @@ private:
     std::vector<std::unique_ptr<Object>> objects_;
 };
 
+/*
+* Пишет SVG-документ прямо в строку, без дерева объектов и без потоков.
+* Текст совпадает с тем, что выводит Document::Render для тех же фигур,
+* числа форматируются так же, как operator<< с настройками потока по умолчанию
+*/
+class StreamWriter
+{
+public:
+    // Атрибуты контура; цвета не копируются и должны жить до конца вызова
+    struct PathAttrs
+    {
+        const Color* fill_color = nullptr;
+        const Color* stroke_color = nullptr;
+        std::optional<double> stroke_width = std::nullopt;
+        std::optional<StrokeLineCap> stroke_line_cap = std::nullopt;
+        std::optional<StrokeLineJoin> stroke_line_join = std::nullopt;
+    };
+
+    struct TextAttrs
+    {
+        Point offset = {0, 0};
+        uint32_t font_size = 1;
+        std::string_view font_family = {};
+        std::string_view font_weight = {};
+    };
+
+    // Документ дописывается в конец buffer
+    explicit StreamWriter(std::string& buffer);
+
+    void BeginDocument();
+    void EndDocument();
+
+    void WriteCircle(Point center, double radius, const PathAttrs& attrs);
+
+    // Вершины ломаной пишутся по одной между BeginPolyline и EndPolyline
+    void BeginPolyline();
+    void AddPolylinePoint(Point point);
+    void EndPolyline(const PathAttrs& attrs);
+
+    void WriteText(Point position, std::string_view data, const TextAttrs& text_attrs, const PathAttrs& attrs);
+
+private:
+    void Write(std::string_view text);
+    void Write(double value);
+    void Write(uint32_t value);
+    void Write(const Color& color);
+    void WriteEscaped(std::string_view text);
+    void WritePathAttrs(const PathAttrs& attrs);
+
+    std::string& buffer_;
+    bool is_first_point_ = true;
+};
+
 } // namespace svg
 
 
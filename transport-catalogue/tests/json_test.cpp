@@ -0,0 +1,386 @@
+// Проверки потокового разбора и вывода JSON.
+// Сборка из каталога transport-catalogue:
+//     g++ -std=c++17 -O2 -I. tests/json_test.cpp json.cpp -o json_test && ./json_test
+
+#include "json.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace std::literals;
+
+namespace {
+
+// Размер блока, которым EventParser читает поток в json.cpp
+const size_t PARSER_BLOCK_SIZE = 1 << 16;
+
+void Check(bool condition, const std::string& message)
+{
+    if(!condition)
+    {
+        throw std::runtime_error(message);
+    }
+}
+
+std::string FormatDouble(double value)
+{
+    std::ostringstream out;
+    out << std::setprecision(17) << value;
+    return out.str();
+}
+
+// Записывает события разбора одной строкой, чтобы сравнить их с деревом, которое строит Load
+class EventRecorder : public json::Handler
+{
+public:
+    void OnNull() override
+    {
+        events_ += "null;"sv;
+    }
+
+    void OnBool(bool value) override
+    {
+        events_ += value ? "true;"sv : "false;"sv;
+    }
+
+    void OnInt(int value) override
+    {
+        events_ += "int "s + std::to_string(value) + ';';
+    }
+
+    void OnDouble(double value) override
+    {
+        events_ += "double "s + FormatDouble(value) + ';';
+    }
+
+    void OnString(std::string_view value) override
+    {
+        events_ += "string "s + std::to_string(value.size()) + ' ';
+        events_ += value;
+        events_ += ';';
+    }
+
+    void OnKey(std::string_view key) override
+    {
+        events_ += "key "s + std::to_string(key.size()) + ' ';
+        events_ += key;
+        events_ += ';';
+    }
+
+    void StartDict() override
+    {
+        events_ += "{;"sv;
+    }
+
+    void EndDict() override
+    {
+        events_ += "};"sv;
+    }
+
+    void StartArray() override
+    {
+        events_ += "[;"sv;
+    }
+
+    void EndArray() override
+    {
+        events_ += "];"sv;
+    }
+
+    const std::string& GetEvents() const
+    {
+        return events_;
+    }
+
+private:
+    std::string events_;
+};
+
+// Те же события, что пришли бы при разборе текста узла. Ключи словаря идут по алфавиту,
+// поэтому в проверяемых текстах они тоже записаны по алфавиту
+void RecordNode(const json::Node& node, EventRecorder& recorder)
+{
+    if(node.IsNull())
+    {
+        recorder.OnNull();
+    }
+    else if(node.IsBool())
+    {
+        recorder.OnBool(node.AsBool());
+    }
+    else if(node.IsInt())
+    {
+        recorder.OnInt(node.AsInt());
+    }
+    else if(node.IsPureDouble())
+    {
+        recorder.OnDouble(node.AsDouble());
+    }
+    else if(node.IsString())
+    {
+        recorder.OnString(node.AsString());
+    }
+    else if(node.IsArray())
+    {
+        recorder.StartArray();
+        for(const json::Node& item : node.AsArray())
+        {
+            RecordNode(item, recorder);
+        }
+        recorder.EndArray();
+    }
+    else
+    {
+        recorder.StartDict();
+        for(const auto& [key, value] : node.AsDict())
+        {
+            recorder.OnKey(key);
+            RecordNode(value, recorder);
+        }
+        recorder.EndDict();
+    }
+}
+
+std::string StreamEvents(const std::string& text)
+{
+    std::istringstream input(text);
+    EventRecorder recorder;
+    json::Parse(input, recorder);
+    return recorder.GetEvents();
+}
+
+std::string BufferEvents(std::string_view text)
+{
+    EventRecorder recorder;
+    json::Parse(text, recorder);
+    return recorder.GetEvents();
+}
+
+std::string TreeEvents(const json::Node& node)
+{
+    EventRecorder recorder;
+    RecordNode(node, recorder);
+    return recorder.GetEvents();
+}
+
+// Значение в массиве, дополненном пробелами так, чтобы первый блок потока кончался внутри значения
+std::string PlaceAtBlockBoundary(std::string_view value, size_t chars_before_boundary)
+{
+    return "["s + std::string(PARSER_BLOCK_SIZE - 1 - chars_before_boundary, ' ') + std::string(value) + "]"s;
+}
+
+void TestTokensAcrossBlockBoundary()
+{
+    // Длинная строка занимает несколько блоков, экранированные символы попадают и на их границы
+    std::string long_string = "\""s;
+    for(size_t i = 0; i < PARSER_BLOCK_SIZE * 2 + 1000; ++i)
+    {
+        long_string += i % 997 == 0 ? "\\\""s : std::string(1, static_cast<char>('a' + i % 26));
+    }
+    long_string += '"';
+
+    const std::vector<std::string> values = {
+        R"("plain string")"s,
+        R"("esc\"aped\\ \n\r\t string")"s,
+        R"("\\")"s,
+        "-12345.678e-2"s,
+        "9876543"s,
+        "-0.5"s,
+        "true"s,
+        "false"s,
+        "null"s,
+        "[]"s,
+        "{}"s,
+        R"({"key": [1, 2.5, "x"], "other": {"nested": null}})"s,
+    };
+
+    for(const std::string& value : values)
+    {
+        const json::Node expected = json::Array{json::Load(value).GetRoot()};
+        for(size_t shift = 0; shift <= value.size(); ++shift)
+        {
+            const std::string text = PlaceAtBlockBoundary(value, shift);
+            const std::string where = value + " at "s + std::to_string(shift) + " chars before the block end"s;
+
+            Check(json::Load(text).GetRoot() == expected, "Load differs: "s + where);
+            Check(StreamEvents(text) == TreeEvents(expected), "Stream parsing differs: "s + where);
+            Check(BufferEvents(text) == TreeEvents(expected), "Buffer parsing differs: "s + where);
+        }
+    }
+
+    for(const size_t shift : {size_t{0}, size_t{1}, size_t{2}, size_t{1000}})
+    {
+        const std::string text = PlaceAtBlockBoundary(long_string, shift);
+        const json::Node expected = json::Array{json::Load(long_string).GetRoot()};
+        Check(StreamEvents(text) == TreeEvents(expected), "Stream parsing differs for a long string at "s + std::to_string(shift));
+    }
+}
+
+void CheckParsingError(const std::string& text)
+{
+    const std::string where = text.size() > 40 ? "..."s + text.substr(text.size() - 40) : text;
+
+    bool is_thrown = false;
+    try
+    {
+        json::Load(text);
+    }
+    catch(const json::ParsingError&)
+    {
+        is_thrown = true;
+    }
+    Check(is_thrown, "Load accepted malformed JSON: "s + where);
+
+    is_thrown = false;
+    try
+    {
+        StreamEvents(text);
+    }
+    catch(const json::ParsingError&)
+    {
+        is_thrown = true;
+    }
+    Check(is_thrown, "Stream parsing accepted malformed JSON: "s + where);
+
+    is_thrown = false;
+    try
+    {
+        BufferEvents(text);
+    }
+    catch(const json::ParsingError&)
+    {
+        is_thrown = true;
+    }
+    Check(is_thrown, "Buffer parsing accepted malformed JSON: "s + where);
+}
+
+void TestMalformedInput()
+{
+    const std::vector<std::string> texts = {
+        ""s,
+        "   "s,
+        "}"s,
+        "[1,"s,
+        "[1 2]"s,
+        "[1,]x"s,
+        R"({"a")"s,
+        R"({"a":)"s,
+        R"({"a" 1})"s,
+        R"({"a": 1 "b": 2})"s,
+        "{1: 2}"s,
+        R"("abc)"s,
+        R"("ab\)"s,
+        "tru"s,
+        "trUe"s,
+        "nul"s,
+        "fals"s,
+        "-"s,
+        "1.2.3"s,
+        "1e"s,
+    };
+
+    // Вне массива, потому что внутри он закрывает массив
+    CheckParsingError("]"s);
+
+    for(const std::string& text : texts)
+    {
+        CheckParsingError(text);
+        // Та же ошибка, когда вход обрывается в конце первого блока
+        CheckParsingError("["s + std::string(PARSER_BLOCK_SIZE - 1 - text.size(), ' ') + text);
+    }
+}
+
+void WriteNode(const json::Node& node, json::StreamWriter& writer)
+{
+    std::visit([&writer](const auto& value)
+    {
+        using Value = std::decay_t<decltype(value)>;
+        if constexpr(std::is_same_v<Value, json::Array>)
+        {
+            writer.BeginArray();
+            for(const json::Node& item : value)
+            {
+                WriteNode(item, writer);
+            }
+            writer.EndArray();
+        }
+        else if constexpr(std::is_same_v<Value, json::Dict>)
+        {
+            writer.BeginObject();
+            for(const auto& [key, item] : value)
+            {
+                writer.Key(key);
+                WriteNode(item, writer);
+            }
+            writer.EndObject();
+        }
+        else if constexpr(std::is_same_v<Value, std::string>)
+        {
+            writer.Value(std::string_view(value));
+        }
+        else
+        {
+            writer.Value(value);
+        }
+    }, node.GetValue());
+}
+
+void TestPrintMatchesStreamWriter()
+{
+    const json::Node node = json::Dict{
+        {"array"s, json::Array{1, 2.5, -3, "x\"y\\z\n\r\t"s, true, false, nullptr, json::Dict{}, json::Array{}}},
+        {"empty"s, ""s},
+        {"nested"s, json::Dict{{"a"s, 1e-7}, {"b"s, json::Dict{{"c"s, json::Array{json::Array{0}}}}}}},
+        {"number"s, 42},
+    };
+
+    for(const json::Node& root : {node, json::Node{}, json::Node{"string \" \\"s}, json::Node{0.1}, json::Node{json::Array{}}})
+    {
+        std::ostringstream printed;
+        json::Print(json::Document(root), printed);
+
+        std::ostringstream written;
+        json::StreamWriter writer(written);
+        WriteNode(root, writer);
+
+        Check(printed.str() == written.str(), "Print and StreamWriter differ: "s + printed.str() + " and "s + written.str());
+        Check(json::Load(written.str()).GetRoot() == root, "Written JSON doesn't load back: "s + written.str());
+    }
+}
+
+} // namespace
+
+int main()
+{
+    const std::vector<std::pair<std::string_view, void (*)()>> tests = {
+        {"TestTokensAcrossBlockBoundary"sv, TestTokensAcrossBlockBoundary},
+        {"TestMalformedInput"sv, TestMalformedInput},
+        {"TestPrintMatchesStreamWriter"sv, TestPrintMatchesStreamWriter},
+    };
+
+    bool is_failed = false;
+    for(const auto& [name, test] : tests)
+    {
+        try
+        {
+            test();
+            std::cerr << name << " OK\n"sv;
+        }
+        catch(const std::exception& error)
+        {
+            std::cerr << name << " failed: "sv << error.what() << '\n';
+            is_failed = true;
+        }
+    }
+
+    return is_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,238 @@
+// Все маршрутизаторы на базах обоих форматов должны строить одни и те же маршруты.
+// Сборка из каталога transport-catalogue:
+//     protoc --cpp_out=. transport_catalogue.proto
+//     g++ -std=c++17 -O2 -pthread -I. tests/router_test.cpp \
+//         $(ls *.cpp *.cc | grep -vx -e main.cpp -e input_reader.cpp -e stat_reader.cpp) -lprotobuf -o router_test && ./router_test
+
+#include "json_reader.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace {
+
+const size_t STOP_COUNT = 60;
+const size_t BUS_COUNT = 20;
+
+void Check(bool condition, const std::string& message)
+{
+    if(!condition)
+    {
+        throw std::runtime_error(message);
+    }
+}
+
+std::string GetStopName(size_t index)
+{
+    return "Stop "s + std::to_string(index);
+}
+
+// Случайная сеть с фиксированным зерном. Расстояния случайные, поэтому равных по времени маршрутов почти нет
+// и разные маршрутизаторы не могут законно выбрать разные пути. Последняя остановка не входит ни в один маршрут
+std::string MakeBaseRequests()
+{
+    std::mt19937 generator(20240917);
+    const auto random = [&generator](size_t bound)
+    {
+        return static_cast<size_t>(generator() % bound);
+    };
+
+    std::vector<std::vector<size_t>> buses(BUS_COUNT);
+    std::map<std::pair<size_t, size_t>, int> distances;
+    for(size_t bus = 0; bus < BUS_COUNT; ++bus)
+    {
+        const size_t stop_count = 3 + random(6);
+        for(size_t i = 0; i < stop_count; ++i)
+        {
+            buses[bus].push_back(random(STOP_COUNT - 1));
+        }
+        // Кольцевой маршрут возвращается на первую остановку
+        if(bus % 2 == 0)
+        {
+            buses[bus].push_back(buses[bus].front());
+        }
+
+        for(size_t i = 1; i < buses[bus].size(); ++i)
+        {
+            distances.emplace(std::make_pair(buses[bus][i - 1], buses[bus][i]), 300 + static_cast<int>(random(3000)));
+            // Обратное расстояние задано не всегда, тогда берётся прямое
+            if(random(2) == 0)
+            {
+                distances.emplace(std::make_pair(buses[bus][i], buses[bus][i - 1]), 300 + static_cast<int>(random(3000)));
+            }
+        }
+    }
+
+    std::ostringstream out;
+    json::StreamWriter writer(out);
+    writer.BeginArray();
+    for(size_t stop = 0; stop < STOP_COUNT; ++stop)
+    {
+        writer.BeginObject()
+              .Key("type"sv).Value("Stop"sv)
+              .Key("name"sv).Value(GetStopName(stop))
+              .Key("latitude"sv).Value(55.55 + static_cast<double>(random(10000)) / 100000)
+              .Key("longitude"sv).Value(37.45 + static_cast<double>(random(10000)) / 100000)
+              .Key("road_distances"sv).BeginObject();
+        for(auto it = distances.lower_bound({stop, 0}); it != distances.end() && it->first.first == stop; ++it)
+        {
+            writer.Key(GetStopName(it->first.second)).Value(it->second);
+        }
+        writer.EndObject()
+              .EndObject();
+    }
+    for(size_t bus = 0; bus < BUS_COUNT; ++bus)
+    {
+        writer.BeginObject()
+              .Key("type"sv).Value("Bus"sv)
+              .Key("name"sv).Value("Bus "s + std::to_string(bus))
+              .Key("stops"sv).BeginArray();
+        for(const size_t stop : buses[bus])
+        {
+            writer.Value(GetStopName(stop));
+        }
+        writer.EndArray()
+              .Key("is_roundtrip"sv).Value(bus % 2 == 0)
+              .EndObject();
+    }
+    writer.EndArray();
+
+    return out.str();
+}
+
+// Маршрут между каждой парой остановок
+std::string MakeStatRequests()
+{
+    std::ostringstream out;
+    json::StreamWriter writer(out);
+    writer.BeginArray();
+    int id = 0;
+    for(size_t from = 0; from < STOP_COUNT; ++from)
+    {
+        for(size_t to = 0; to < STOP_COUNT; ++to)
+        {
+            writer.BeginObject()
+                  .Key("id"sv).Value(++id)
+                  .Key("type"sv).Value("Route"sv)
+                  .Key("from"sv).Value(GetStopName(from))
+                  .Key("to"sv).Value(GetStopName(to))
+                  .EndObject();
+        }
+    }
+    writer.EndArray();
+
+    return out.str();
+}
+
+// Собирает базу с нужным маршрутизатором, загружает её заново и возвращает ответы на запросы
+std::string BuildRoutes(std::string_view router_type, std::string_view format, const std::string& file,
+                        const std::string& base_requests, const std::string& stat_requests)
+{
+    {
+        std::ostringstream make_base;
+        json::StreamWriter writer(make_base);
+        writer.BeginObject()
+              .Key("serialization_settings"sv).BeginObject()
+                  .Key("file"sv).Value(file)
+                  .Key("format"sv).Value(format)
+              .EndObject()
+              .Key("routing_settings"sv).BeginObject()
+                  .Key("bus_wait_time"sv).Value(6)
+                  .Key("bus_velocity"sv).Value(40)
+                  .Key("router_type"sv).Value(router_type)
+              .EndObject()
+              .Key("base_requests"sv).RawValue(base_requests)
+              .EndObject();
+
+        transport::Catalogue transport_catalogue;
+        route::TransportRouter transport_router;
+        transport::renderer::MapRenderer map_renderer;
+        transport::request::RequestHandler request_handler(transport_catalogue, transport_router, map_renderer);
+        transport::request::JsonReader json_reader(request_handler, transport_catalogue, map_renderer, transport_router);
+        std::istringstream in(make_base.str());
+        json_reader.ExecMakeBase(in);
+    }
+
+    std::ostringstream process_requests;
+    json::StreamWriter writer(process_requests);
+    writer.BeginObject()
+          .Key("serialization_settings"sv).BeginObject()
+              .Key("file"sv).Value(file)
+              .Key("format"sv).Value(format)
+          .EndObject()
+          .Key("stat_requests"sv).RawValue(stat_requests)
+          .EndObject();
+
+    transport::Catalogue transport_catalogue;
+    route::TransportRouter transport_router;
+    transport::renderer::MapRenderer map_renderer;
+    transport::request::RequestHandler request_handler(transport_catalogue, transport_router, map_renderer);
+    transport::request::JsonReader json_reader(request_handler, transport_catalogue, map_renderer, transport_router);
+    std::istringstream in(process_requests.str());
+    std::ostringstream out;
+    json_reader.ExecProcessRequest(in, out);
+
+    return out.str();
+}
+
+void TestRoutersAgree()
+{
+    const std::string base_requests = MakeBaseRequests();
+    const std::string stat_requests = MakeStatRequests();
+    const std::string file = (std::filesystem::temp_directory_path() / "transport_catalogue_router_test.db").string();
+
+    // Эталон - Дейкстра по базе protobuf: он ничего не хранит в базе и не зависит от её формата
+    const std::string expected = BuildRoutes("dijkstra"sv, "protobuf"sv, file, base_requests, stat_requests);
+
+    const json::Array routes = json::Load(expected).GetRoot().AsArray();
+    Check(routes.size() == STOP_COUNT * STOP_COUNT, "Wrong number of answers"s);
+    size_t found_count = 0;
+    for(const json::Node& route : routes)
+    {
+        found_count += route.AsDict().count("items"s);
+    }
+    // Маршрутов должно хватать, иначе сравнивать почти нечего; до остановки без автобусов их нет
+    Check(found_count > routes.size() / 4, "Too few routes found: "s + std::to_string(found_count));
+    Check(found_count < routes.size(), "The stop without buses is reachable"s);
+
+    for(const std::string_view format : {"protobuf"sv, "flat"sv})
+    {
+        for(const std::string_view router_type : {"dijkstra"sv, "all_pairs"sv, "parallel_all_pairs"sv, "compact_all_pairs"sv, "contraction_hierarchies"sv})
+        {
+            const std::string routes = BuildRoutes(router_type, format, file, base_requests, stat_requests);
+            Check(routes == expected, std::string(router_type) + " on a "s + std::string(format) + " base builds other routes"s);
+        }
+    }
+
+    std::remove(file.c_str());
+}
+
+} // namespace
+
+int main()
+{
+    try
+    {
+        TestRoutersAgree();
+        std::cerr << "TestRoutersAgree OK\n"sv;
+    }
+    catch(const std::exception& error)
+    {
+        std::cerr << "TestRoutersAgree failed: "sv << error.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
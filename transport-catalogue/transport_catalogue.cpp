@@ -6,231 +6,348 @@
 
 namespace transport {
 
-void Catalogue::AddStop(const std::string& name, double lat, double lng)
+void Catalogue::AddStop(std::string_view name, double lat, double lng)
 {
     geo::Coordinates coordinates = {lat, lng};
 
-    auto *stop = new domain::Stop();
-    stop->name_ = name;
-    stop->coordinates_ = coordinates;
+    const domain::NameId name_id = names_.Intern(name);
+    auto *stop = arena_.Create<domain::Stop>(names_.GetName(name_id), coordinates, arena_);
+    stop->id_ = static_cast<domain::StopId>(stops_by_id_.size());
+    stop->name_id_ = name_id;
 
-    base_stops_.push_back(*stop);
-    stops_.insert({stop->name_, stop});
-    stop_for_buses_[stop->name_];
+    if(stops_by_name_.size() <= name_id)
+    {
+        stops_by_name_.resize(name_id + 1, nullptr);
+    }
+    stops_by_name_[name_id] = stop;
+    stops_by_id_.push_back(stop);
+    buses_by_stop_.emplace_back();
+    coordinates_.Add(coordinates);
 }
 
-void Catalogue::AddBus(const std::string& name, const std::vector<std::string>& stops, bool is_roundtrip)
+void Catalogue::AddBus(std::string_view name, const std::vector<std::string>& stops, bool is_roundtrip)
 {
-    std::deque<domain::Stop *> deque_stops;
-    auto *bus = new domain::Bus();
-    bus->name_ = name;
-    bus->is_roundtrip_ = is_roundtrip;
-
+    std::vector<domain::StopId> stop_ids;
+    stop_ids.reserve(stops.size());
     for(const auto& stop: stops)
     {
-        domain::Stop *s = FindStop(stop);
-        deque_stops.push_back(s);
-        s->buses_.insert(bus->name_);
-        bus->unique_stops_.insert(s->name_);
+        stop_ids.push_back(FindStop(stop)->id_);
     }
 
-    bus->stops_ = deque_stops;
+    domain::Bus* bus = CreateBus(name, stop_ids, is_roundtrip);
+    ComputeBusStatistics(bus);
+}
+
+void Catalogue::AddBus(std::string_view name, const std::vector<domain::StopId>& stops, bool is_roundtrip, const domain::BusInfo& bus_info)
+{
+    domain::Bus* bus = CreateBus(name, stops, is_roundtrip);
+    bus->stops_count_ = bus_info.stops_count_;
+    bus->unique_stops_count_ = bus_info.unique_stops_count_;
+    bus->distance_ = bus_info.distance_;
+    bus->curvature_ = bus_info.curvature_;
+}
+
+domain::Bus* Catalogue::CreateBus(std::string_view name, const std::vector<domain::StopId>& stops, bool is_roundtrip)
+{
+    const domain::NameId name_id = names_.Intern(name);
+    auto *bus = arena_.Create<domain::Bus>(names_.GetName(name_id), is_roundtrip, arena_);
+    bus->id_ = static_cast<domain::BusId>(buses_by_id_.size());
+    bus->name_id_ = name_id;
+
+    bus->stops_.reserve(stops.size());
+    for(const domain::StopId stop: stops)
+    {
+        domain::Stop *s = stops_by_id_.at(stop);
+        bus->stops_.push_back(s);
+        s->buses_.insert(bus->name_);
+    }
 
     for(auto stop: bus->stops_)
     {
-        stop_for_buses_[stop->name_].insert(bus->name_);
+        std::vector<domain::BusId>& stop_buses = buses_by_stop_[stop->id_];
+        if(stop_buses.empty())
+        {
+            served_stops_sorted_by_name_.insert(stop);
+        }
+        if(stop_buses.empty() || stop_buses.back() != bus->id_)
+        {
+            stop_buses.push_back(bus->id_);
+        }
+    }
+
+    if(buses_by_name_.size() <= name_id)
+    {
+        buses_by_name_.resize(name_id + 1, nullptr);
+    }
+    buses_by_name_[name_id] = bus;
+    buses_by_id_.push_back(bus);
+    buses_sorted_by_name_.insert(bus);
+
+    return bus;
+}
+
+void Catalogue::ComputeBusStatistics(domain::Bus* bus) const
+{
+    // Географические длины всех перегонов считаются одним пакетом, у кольцевого добавляется перегон из конца в начало
+    std::vector<domain::StopId> stops_from;
+    std::vector<domain::StopId> stops_to;
+    stops_from.reserve(bus->stops_.size());
+    stops_to.reserve(bus->stops_.size());
+    for(size_t i = 0; i + 1 < bus->stops_.size(); ++i)
+    {
+        stops_from.push_back(bus->stops_[i]->id_);
+        stops_to.push_back(bus->stops_[i + 1]->id_);
+    }
+    if(bus->is_roundtrip_)
+    {
+        stops_from.push_back(bus->stops_.back()->id_);
+        stops_to.push_back(bus->stops_.front()->id_);
+    }
+
+    std::vector<double> geo_distances(stops_from.size());
+    coordinates_.ComputeDistances(stops_from.data(), stops_to.data(), stops_from.size(), geo_distances.data());
+
+    double distance = 0.0;
+    double geo_distance = 0.0;
+
+    for(size_t i = 0; i < stops_from.size(); ++i)
+    {
+        if(bus->is_roundtrip_)
+        {
+            distance += GetDistance(stops_from[i], stops_to[i]);
+            geo_distance += geo_distances[i];
+        }
+        else
+        {
+            distance += GetDistance(stops_from[i], stops_to[i]) + GetDistance(stops_to[i], stops_from[i]);
+            geo_distance += geo_distances[i] * 2;
+        }
     }
 
-    for(size_t i = 0; i < bus->stops_.size() - 1; ++i)
+    std::vector<domain::StopId> unique_stops;
+    unique_stops.reserve(bus->stops_.size());
+    for(const domain::Stop* stop : bus->stops_)
     {
-        bus->geo_distance_ += ComputeDistance(bus->stops_[i]->coordinates_, bus->stops_[i + 1]->coordinates_);
-        bus->distance_ += GetDistance(bus->stops_[i]->name_, bus->stops_[i + 1]->name_);
+        unique_stops.push_back(stop->id_);
     }
+    std::sort(unique_stops.begin(), unique_stops.end());
 
-    base_buses_.emplace_back(*bus);
-    buses_.insert({bus->name_, bus});
+    bus->stops_count_ = bus->is_roundtrip_ ? bus->stops_.size() : bus->stops_.size() * 2 - 1;
+    bus->unique_stops_count_ = std::unique(unique_stops.begin(), unique_stops.end()) - unique_stops.begin();
+    bus->distance_ = distance;
+    bus->curvature_ = distance / geo_distance;
 }
 
 domain::Stop *Catalogue::FindStop(const std::string_view& name) const
 {
-    if(stops_.count(name) != 0)
+    const domain::NameId name_id = names_.Find(name);
+    if(name_id < stops_by_name_.size())
     {
-        return stops_.at(name);
+        return stops_by_name_[name_id];
     }
 
     return nullptr;
 }
 
+domain::Stop* Catalogue::FindStop(domain::StopId id) const
+{
+    return stops_by_id_.at(id);
+}
+
 domain::Bus *Catalogue::FindBus(const std::string_view& name) const
 {
-    if(buses_.count(name) != 0)
+    const domain::NameId name_id = names_.Find(name);
+    if(name_id < buses_by_name_.size())
     {
-        return buses_.at(name);
+        return buses_by_name_[name_id];
     }
 
     return nullptr;
 }
 
-void Catalogue::AddDistance(const std::string& stop1, const std::string& stop2, double distance)
+domain::Bus* Catalogue::FindBus(domain::BusId id) const
+{
+    return buses_by_id_.at(id);
+}
+
+size_t Catalogue::GetStopCount() const
 {
-    domain::Stop* s1 = FindStop(stop1);
-    domain::Stop* s2 = FindStop(stop2);
-    distance_between_stops_[s1->name_][s2->name_] = distance;
+    return stops_by_id_.size();
+}
+
+size_t Catalogue::GetBusCount() const
+{
+    return buses_by_id_.size();
+}
+
+void Catalogue::AddDistance(std::string_view stop1, std::string_view stop2, double distance)
+{
+    AddDistance(FindStop(stop1)->id_, FindStop(stop2)->id_, distance);
+}
+
+void Catalogue::AddDistance(domain::StopId stop1, domain::StopId stop2, double distance)
+{
+    distance_between_stops_.Set(stop1, stop2, distance);
 }
 
 double Catalogue::GetDistance(const std::string& stop1, const std::string& stop2) const
 {
-    if (distance_between_stops_.count(stop1) != 0)
-    {
-        if (distance_between_stops_.at(stop1).count(stop2) != 0)
-        {
-            return distance_between_stops_.at(stop1).at(stop2);
-        }
-    }
+    return GetDistance(FindStop(stop1)->id_, FindStop(stop2)->id_);
+}
 
-    if (distance_between_stops_.count(stop2) != 0)
+double Catalogue::GetDistance(domain::StopId stop1, domain::StopId stop2) const
+{
+    if(const double* distance = distance_between_stops_.Find(stop1, stop2))
     {
-        if (distance_between_stops_.at(stop2).count(stop1) != 0)
-        {
-            return distance_between_stops_.at(stop2).at(stop1);
-        }
+        return *distance;
     }
 
-    return geo::ComputeDistance(FindStop(stop1)->coordinates_, FindStop(stop2)->coordinates_);
+    return coordinates_.ComputeDistance(stop1, stop2);
 }
 
-std::unordered_map<std::string_view, std::unordered_map<std::string_view, double>> Catalogue::GetAllDistances() const
+const DistanceTable& Catalogue::GetAllDistances() const
 {
     return distance_between_stops_;
 }
 
+void Catalogue::ComputeGeoDistances(const domain::StopId* from, const domain::StopId* to, size_t count, double* out) const
+{
+    coordinates_.ComputeDistances(from, to, count, out);
+}
+
 domain::StopInfo Catalogue::GetStopInfo(const std::string_view& name) const
 {
     domain::StopInfo stop_info;
     stop_info.name_ = name;
 
-    if (stop_for_buses_.count(name) == 0)
+    domain::Stop *s = FindStop(name);
+    if(s == nullptr)
     {
         stop_info.is_exist_ = false;
         return stop_info;
     }
 
-    domain::Stop *s = FindStop(name);
-    stop_info.buses_ = s->buses_;
+    stop_info.buses_.insert(s->buses_.begin(), s->buses_.end());
 
     return stop_info;
 }
 
 domain::BusInfo Catalogue::GetBusInfo(const std::string_view& name) const
 {
-    domain::BusInfo bus_info;
-    domain::Bus* route = FindBus(name);
-
+    const domain::Bus* route = FindBus(name);
     if(route == nullptr)
     {
-        return domain::BusInfo({name, 0, 0, 0.0, 0.0});
+        return domain::BusInfo(name, 0, 0, 0.0, 0.0, false);
     }
 
-    bus_info.unique_stops_count_ = route->unique_stops_.size();
+    return domain::BusInfo(route->name_, route->stops_count_, route->unique_stops_count_, route->distance_, route->curvature_);
+}
+
+std::vector<const domain::Bus*> Catalogue::GetBuses() const
+{
+    return std::vector<const domain::Bus*>(buses_by_id_.begin(), buses_by_id_.end());
+}
 
-    double distance = 0.0;
-    double geo_distance = 0.0;
+std::vector<const domain::Stop*> Catalogue::GetStops() const
+{
+    return std::vector<const domain::Stop*>(stops_by_id_.begin(), stops_by_id_.end());
+}
 
-    for(auto stop_from = route->stops_.begin(); stop_from + 1 != route->stops_.end(); ++stop_from)
+std::vector<domain::Stop*> Catalogue::GetBusStops(const domain::Bus* bus) const
+{
+    std::vector<domain::Stop*> result(bus->stops_.begin(), bus->stops_.end());
+    if(!bus->is_roundtrip_)
     {
-        auto stop_to = next(stop_from, 1);
-        if (route->is_roundtrip_)
-        {
-            distance += GetDistance((*stop_from)->name_, (*stop_to)->name_);
-            geo_distance += geo::ComputeDistance((*stop_from)->coordinates_, (*stop_to)->coordinates_);
-        }
-        else
-        {
-            distance += GetDistance((*stop_from)->name_, (*stop_to)->name_) + GetDistance((*stop_to)->name_, (*stop_from)->name_);
-            geo_distance += geo::ComputeDistance((*stop_from)->coordinates_, (*stop_to)->coordinates_) * 2;
-        }
+        result.insert(result.end(), bus->stops_.rbegin() + 1, bus->stops_.rend());
     }
 
-    if(route->is_roundtrip_)
+    return result;
+}
+
+std::vector<domain::StopId> Catalogue::GetBusStops(domain::BusId bus) const
+{
+    const domain::Bus* b = buses_by_id_.at(bus);
+
+    std::vector<domain::StopId> result;
+    result.reserve(b->is_roundtrip_ ? b->stops_.size() : b->stops_.size() * 2 - 1);
+    for(const domain::Stop* stop : b->stops_)
     {
-        bus_info.stops_count_ = route->stops_.size();
-        distance += GetDistance((*(route->stops_.end() - 1))->name_, (*route->stops_.begin())->name_);
-        geo_distance += geo::ComputeDistance((*(route->stops_.end() - 1))->coordinates_, (*route->stops_.begin())->coordinates_);
+        result.push_back(stop->id_);
     }
-    else
+    if(!b->is_roundtrip_)
     {
-        bus_info.stops_count_ = route->stops_.size() * 2 - 1;
+        for(auto it = b->stops_.rbegin() + 1; it != b->stops_.rend(); ++it)
+        {
+            result.push_back((*it)->id_);
+        }
     }
 
-    bus_info.distance_ = distance;
-    bus_info.curvature_ = distance / geo_distance;
-
-    return bus_info;
+    return result;
 }
 
-std::vector<const domain::Bus*> Catalogue::GetBuses() const
+const std::multiset<const domain::Bus*, domain::NameLess>& Catalogue::GetBusesSortedByName() const
 {
-    std::vector<const domain::Bus*> buses;
-    for(auto& bus : base_buses_)
-    {
-        buses.push_back(buses_.at(bus.name_));
-    }
+    return buses_sorted_by_name_;
+}
 
-    return buses;
+const std::multiset<const domain::Stop*, domain::NameLess>& Catalogue::GetServedStopsSortedByName() const
+{
+    return served_stops_sorted_by_name_;
 }
 
-std::vector<const domain::Stop*> Catalogue::GetStops() const
+bool Catalogue::HasBuses(const domain::Stop *stop) const
 {
-    std::vector<const domain::Stop*> stops;
+    return !buses_by_stop_.at(stop->id_).empty();
+}
 
-    for(auto& stop: base_stops_)
+std::unordered_set<const domain::Bus*> Catalogue::GetBusesByStop(std::string_view stop_name) const
+{
+    std::unordered_set<const domain::Bus*> buses;
+    for(const domain::BusId bus : GetBusesByStop(FindStop(stop_name)->id_))
     {
-        stops.push_back(stops_.at(stop.name_));
+        buses.insert(buses_by_id_[bus]);
     }
 
-    return stops;
+    return buses;
 }
 
-std::vector<domain::Stop*> Catalogue::GetBusStops(const domain::Bus* bus) const
+const std::vector<domain::BusId>& Catalogue::GetBusesByStop(domain::StopId stop) const
 {
-    if(bus->is_roundtrip_)
-    {
-        return std::vector(bus->stops_.begin(), bus->stops_.end());
-    }
-    else
-    {
-        std::vector<domain::Stop*> result(bus->stops_.begin(), bus->stops_.end());
-        for(auto it = bus->stops_.end() - 2; it >= bus->stops_.begin(); --it)
-        {
-            result.push_back(*it);
-        }
+    return buses_by_stop_.at(stop);
+}
 
-        return result;
-    }
+const domain::NamePool& Catalogue::GetNamePool() const
+{
+    return names_;
 }
 
-bool Catalogue::HasBuses(const domain::Stop *stop) const
+void Catalogue::BuildStopIndex()
 {
-    if(stop_for_buses_.count(stop->name_))
+    std::vector<geo::Coordinates> coordinates;
+    coordinates.reserve(stops_by_id_.size());
+    for(const domain::Stop* stop : stops_by_id_)
     {
-        if(!stop_for_buses_.at(stop->name_).empty())
-        {
-            return true;
-        }
+        coordinates.push_back(stop->coordinates_);
     }
 
-    return false;
+    stop_index_.Build(coordinates);
 }
 
-std::unordered_set<const domain::Bus*> Catalogue::GetBusesByStop(std::string_view stop_name) const
+void Catalogue::BuildStopIndex(std::vector<domain::StopId> order)
 {
-    std::unordered_set<const domain::Bus*> buses;
-    for(auto& route: stop_for_buses_.at(stop_name))
+    std::vector<geo::Coordinates> coordinates;
+    coordinates.reserve(stops_by_id_.size());
+    for(const domain::Stop* stop : stops_by_id_)
     {
-        buses.insert(buses_.at(route));
+        coordinates.push_back(stop->coordinates_);
     }
 
-    return buses;
+    stop_index_.Build(coordinates, std::move(order));
+}
+
+const geo::SpatialIndex& Catalogue::GetStopIndex() const
+{
+    return stop_index_;
 }
 
 } // namespace transport
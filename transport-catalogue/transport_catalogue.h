@@ -1,7 +1,11 @@
 #pragma once
 
+#include "arena.h"
 #include "domain.h"
+#include "distance_table.h"
 #include "geo.h"
+#include "name_pool.h"
+#include "spatial_index.h"
 
 #include <string>
 #include <deque>
@@ -16,15 +20,26 @@ namespace transport {
 class Catalogue
 {
 public:
-    void AddStop(const std::string& name, double lat, double lng);
-    void AddBus(const std::string& name, const std::vector<std::string>& stops, bool is_roundtrip);
+    void AddStop(std::string_view name, double lat, double lng);
+    void AddBus(std::string_view name, const std::vector<std::string>& stops, bool is_roundtrip);
+    // Маршрут с уже посчитанной статистикой, например из файла базы
+    void AddBus(std::string_view name, const std::vector<domain::StopId>& stops, bool is_roundtrip, const domain::BusInfo& bus_info);
 
     domain::Stop* FindStop(const std::string_view& name) const;
+    domain::Stop* FindStop(domain::StopId id) const;
     domain::Bus* FindBus(const std::string_view& name) const;
+    domain::Bus* FindBus(domain::BusId id) const;
 
-    void AddDistance(const std::string& stop1, const std::string& stop2, double distance);
+    size_t GetStopCount() const;
+    size_t GetBusCount() const;
+
+    void AddDistance(std::string_view stop1, std::string_view stop2, double distance);
+    void AddDistance(domain::StopId stop1, domain::StopId stop2, double distance);
     double GetDistance(const std::string& stop1, const std::string& stop2) const;
-    std::unordered_map<std::string_view, std::unordered_map<std::string_view, double>> GetAllDistances() const;
+    double GetDistance(domain::StopId stop1, domain::StopId stop2) const;
+    const DistanceTable& GetAllDistances() const;
+    // Расстояния по поверхности Земли между остановками from[i] и to[i]
+    void ComputeGeoDistances(const domain::StopId* from, const domain::StopId* to, size_t count, double* out) const;
 
     domain::StopInfo GetStopInfo(const std::string_view& name) const;
     domain::BusInfo GetBusInfo(const std::string_view& name) const;
@@ -32,18 +47,48 @@ public:
     std::vector<const domain::Bus*> GetBuses() const;
     std::vector<const domain::Stop*> GetStops() const;
     std::vector<domain::Stop*> GetBusStops(const domain::Bus* bus) const;
+    std::vector<domain::StopId> GetBusStops(domain::BusId bus) const;
+
+    // Маршруты и остановки, через которые проходит хотя бы один маршрут, в порядке имён.
+    // Порядок поддерживается при добавлении, так что отрисовке карты не нужно ничего сортировать
+    const std::multiset<const domain::Bus*, domain::NameLess>& GetBusesSortedByName() const;
+    const std::multiset<const domain::Stop*, domain::NameLess>& GetServedStopsSortedByName() const;
 
     bool HasBuses(const domain::Stop* stop) const;
     std::unordered_set<const domain::Bus*> GetBusesByStop(std::string_view stop_name) const;
+    const std::vector<domain::BusId>& GetBusesByStop(domain::StopId stop) const;
+
+    const domain::NamePool& GetNamePool() const;
+
+    // Пространственный индекс остановок строится после добавления всех остановок
+    void BuildStopIndex();
+    // Индекс с готовым порядком остановок, например из файла базы
+    void BuildStopIndex(std::vector<domain::StopId> order);
+    const geo::SpatialIndex& GetStopIndex() const;
 
 private:
-    std::deque<domain::Stop> base_stops_;
-    std::deque<domain::Bus> base_buses_;
+    domain::Bus* CreateBus(std::string_view name, const std::vector<domain::StopId>& stops, bool is_roundtrip);
+    void ComputeBusStatistics(domain::Bus* bus) const;
+
+    // Владеет всеми остановками и маршрутами, поэтому объявлена первой и разрушается последней
+    memory::Arena arena_;
+    // Все имена остановок и маршрутов, string_view в Stop и Bus указывают сюда
+    domain::NamePool names_;
+
+    // Внутри справочник работает с номерами, имена нужны только на входе запросов.
+    // Остановка и маршрут по номеру имени из пула, nullptr если имя принадлежит другому виду
+    std::vector<domain::Stop*> stops_by_name_;
+    std::vector<domain::Bus*> buses_by_name_;
 
-    std::unordered_map<std::string_view, domain::Stop*> stops_;
-    std::unordered_map<std::string_view, domain::Bus*> buses_;
-    std::unordered_map<std::string_view, std::set<std::string_view>> stop_for_buses_;
-    std::unordered_map<std::string_view, std::unordered_map<std::string_view, double>> distance_between_stops_;
+    std::vector<domain::Stop*> stops_by_id_;
+    std::vector<domain::Bus*> buses_by_id_;
+    std::vector<std::vector<domain::BusId>> buses_by_stop_;
+    std::multiset<const domain::Bus*, domain::NameLess> buses_sorted_by_name_;
+    std::multiset<const domain::Stop*, domain::NameLess> served_stops_sorted_by_name_;
+    DistanceTable distance_between_stops_;
+    // Координаты остановок по номерам, отдельно от Stop, чтобы пакетный расчёт расстояний шёл по плотным массивам
+    geo::CoordinateTable coordinates_;
+    geo::SpatialIndex stop_index_;
 };
 
 } // namespace transport
@@ -39,6 +39,7 @@ PROTOBUF_CONSTEXPR Stop::Stop(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.coordinates_)*/nullptr
+  , /*decltype(_impl_.name_id_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopDefaultTypeInternal {
   PROTOBUF_CONSTEXPR StopDefaultTypeInternal()
@@ -54,6 +55,8 @@ PROTOBUF_CONSTEXPR Distance::Distance(
     /*decltype(_impl_.stop_from_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.stop_to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.distance_)*/0
+  , /*decltype(_impl_.stop_from_id_)*/0u
+  , /*decltype(_impl_.stop_to_id_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct DistanceDefaultTypeInternal {
   PROTOBUF_CONSTEXPR DistanceDefaultTypeInternal()
@@ -67,8 +70,15 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR Bus::Bus(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_.stop_ids_)*/{}
+  , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.is_roundtrip_)*/false
+  , /*decltype(_impl_.stop_count_)*/0u
+  , /*decltype(_impl_.route_length_)*/0
+  , /*decltype(_impl_.unique_stop_count_)*/0u
+  , /*decltype(_impl_.name_id_)*/0u
+  , /*decltype(_impl_.curvature_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct BusDefaultTypeInternal {
   PROTOBUF_CONSTEXPR BusDefaultTypeInternal()
@@ -84,6 +94,9 @@ PROTOBUF_CONSTEXPR TransportCatalogue::TransportCatalogue(
     /*decltype(_impl_.stops_)*/{}
   , /*decltype(_impl_.distances_)*/{}
   , /*decltype(_impl_.buses_)*/{}
+  , /*decltype(_impl_.names_)*/{}
+  , /*decltype(_impl_.stop_index_)*/{}
+  , /*decltype(_impl_._stop_index_cached_byte_size_)*/{0}
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TransportCatalogueDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TransportCatalogueDefaultTypeInternal()
@@ -183,6 +196,9 @@ PROTOBUF_CONSTEXPR RoutingSettings::RoutingSettings(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.bus_wait_time_)*/0
   , /*decltype(_impl_.bus_velocity_)*/0
+  , /*decltype(_impl_.walking_velocity_)*/0
+  , /*decltype(_impl_.router_type_)*/0
+  , /*decltype(_impl_.walking_stop_count_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RoutingSettingsDefaultTypeInternal {
   PROTOBUF_CONSTEXPR RoutingSettingsDefaultTypeInternal()
@@ -226,6 +242,7 @@ PROTOBUF_CONSTEXPR Graph::Graph(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.edges_)*/{}
   , /*decltype(_impl_.incidence_lists_)*/{}
+  , /*decltype(_impl_.vertex_count_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct GraphDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GraphDefaultTypeInternal()
@@ -241,6 +258,7 @@ PROTOBUF_CONSTEXPR StopVertexId::StopVertexId(
     /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.start_wait_)*/0u
   , /*decltype(_impl_.end_wait_)*/0u
+  , /*decltype(_impl_.stop_id_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopVertexIdDefaultTypeInternal {
   PROTOBUF_CONSTEXPR StopVertexIdDefaultTypeInternal()
@@ -257,6 +275,7 @@ PROTOBUF_CONSTEXPR EdgeInfo::EdgeInfo(
   , /*decltype(_impl_.edge_)*/nullptr
   , /*decltype(_impl_.time_)*/0
   , /*decltype(_impl_.span_count_)*/0u
+  , /*decltype(_impl_.name_id_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EdgeInfoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EdgeInfoDefaultTypeInternal()
@@ -267,12 +286,63 @@ struct EdgeInfoDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeInfoDefaultTypeInternal _EdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR RoutesInternalDataRow::RoutesInternalDataRow(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vertex_to_)*/{}
+  , /*decltype(_impl_._vertex_to_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.weight_)*/{}
+  , /*decltype(_impl_.prev_edge_)*/{}
+  , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutesInternalDataRowDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutesInternalDataRowDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutesInternalDataRowDefaultTypeInternal() {}
+  union {
+    RoutesInternalDataRow _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutesInternalDataRowDefaultTypeInternal _RoutesInternalDataRow_default_instance_;
+PROTOBUF_CONSTEXPR Shortcut::Shortcut(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.first_edge_)*/0u
+  , /*decltype(_impl_.second_edge_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ShortcutDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShortcutDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShortcutDefaultTypeInternal() {}
+  union {
+    Shortcut _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShortcutDefaultTypeInternal _Shortcut_default_instance_;
+PROTOBUF_CONSTEXPR ContractionHierarchy::ContractionHierarchy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ranks_)*/{}
+  , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.shortcuts_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ContractionHierarchyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContractionHierarchyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContractionHierarchyDefaultTypeInternal() {}
+  union {
+    ContractionHierarchy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
 PROTOBUF_CONSTEXPR TransportRouter::TransportRouter(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.stop_vertex_ids_)*/{}
   , /*decltype(_impl_.edges_info_)*/{}
+  , /*decltype(_impl_.routes_internal_data_)*/{}
   , /*decltype(_impl_.routing_settings_)*/nullptr
   , /*decltype(_impl_.graph_)*/nullptr
+  , /*decltype(_impl_.contraction_hierarchy_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TransportRouterDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TransportRouterDefaultTypeInternal()
@@ -285,7 +355,8 @@ struct TransportRouterDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportRouterDefaultTypeInternal _TransportRouter_default_instance_;
 PROTOBUF_CONSTEXPR Main::Main(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.transport_catalogue_)*/nullptr
+    /*decltype(_impl_.rendered_map_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transport_catalogue_)*/nullptr
   , /*decltype(_impl_.render_settings_)*/nullptr
   , /*decltype(_impl_.transport_router_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
@@ -299,8 +370,8 @@ struct MainDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MainDefaultTypeInternal _Main_default_instance_;
 }  // namespace proto
-static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[18];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalogue_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[21];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transport_5fcatalogue_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
 
 const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -320,6 +391,7 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto::Stop, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::proto::Stop, _impl_.coordinates_),
+  PROTOBUF_FIELD_OFFSET(::proto::Stop, _impl_.name_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Distance, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -329,6 +401,8 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::Distance, _impl_.stop_from_),
   PROTOBUF_FIELD_OFFSET(::proto::Distance, _impl_.stop_to_),
   PROTOBUF_FIELD_OFFSET(::proto::Distance, _impl_.distance_),
+  PROTOBUF_FIELD_OFFSET(::proto::Distance, _impl_.stop_from_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::Distance, _impl_.stop_to_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Bus, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -338,6 +412,12 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.stops_),
   PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.is_roundtrip_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.stop_count_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.unique_stop_count_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.route_length_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.curvature_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.name_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::Bus, _impl_.stop_ids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -347,6 +427,8 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _impl_.stops_),
   PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _impl_.distances_),
   PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _impl_.buses_),
+  PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _impl_.names_),
+  PROTOBUF_FIELD_OFFSET(::proto::TransportCatalogue, _impl_.stop_index_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Point, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -410,6 +492,9 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto::RoutingSettings, _impl_.bus_wait_time_),
   PROTOBUF_FIELD_OFFSET(::proto::RoutingSettings, _impl_.bus_velocity_),
+  PROTOBUF_FIELD_OFFSET(::proto::RoutingSettings, _impl_.router_type_),
+  PROTOBUF_FIELD_OFFSET(::proto::RoutingSettings, _impl_.walking_velocity_),
+  PROTOBUF_FIELD_OFFSET(::proto::RoutingSettings, _impl_.walking_stop_count_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Edge, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -434,6 +519,7 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto::Graph, _impl_.edges_),
   PROTOBUF_FIELD_OFFSET(::proto::Graph, _impl_.incidence_lists_),
+  PROTOBUF_FIELD_OFFSET(::proto::Graph, _impl_.vertex_count_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::StopVertexId, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -443,6 +529,7 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::StopVertexId, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::proto::StopVertexId, _impl_.start_wait_),
   PROTOBUF_FIELD_OFFSET(::proto::StopVertexId, _impl_.end_wait_),
+  PROTOBUF_FIELD_OFFSET(::proto::StopVertexId, _impl_.stop_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::EdgeInfo, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -453,6 +540,35 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::EdgeInfo, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::proto::EdgeInfo, _impl_.span_count_),
   PROTOBUF_FIELD_OFFSET(::proto::EdgeInfo, _impl_.time_),
+  PROTOBUF_FIELD_OFFSET(::proto::EdgeInfo, _impl_.name_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::RoutesInternalDataRow, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::RoutesInternalDataRow, _impl_.vertex_to_),
+  PROTOBUF_FIELD_OFFSET(::proto::RoutesInternalDataRow, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::proto::RoutesInternalDataRow, _impl_.prev_edge_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _impl_.first_edge_),
+  PROTOBUF_FIELD_OFFSET(::proto::Shortcut, _impl_.second_edge_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::ContractionHierarchy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::ContractionHierarchy, _impl_.ranks_),
+  PROTOBUF_FIELD_OFFSET(::proto::ContractionHierarchy, _impl_.shortcuts_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -463,6 +579,8 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _impl_.graph_),
   PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _impl_.stop_vertex_ids_),
   PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _impl_.edges_info_),
+  PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _impl_.routes_internal_data_),
+  PROTOBUF_FIELD_OFFSET(::proto::TransportRouter, _impl_.contraction_hierarchy_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Main, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -472,26 +590,30 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto::Main, _impl_.transport_catalogue_),
   PROTOBUF_FIELD_OFFSET(::proto::Main, _impl_.render_settings_),
   PROTOBUF_FIELD_OFFSET(::proto::Main, _impl_.transport_router_),
+  PROTOBUF_FIELD_OFFSET(::proto::Main, _impl_.rendered_map_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::proto::Coordinates)},
   { 8, -1, -1, sizeof(::proto::Stop)},
-  { 16, -1, -1, sizeof(::proto::Distance)},
-  { 25, -1, -1, sizeof(::proto::Bus)},
-  { 34, -1, -1, sizeof(::proto::TransportCatalogue)},
-  { 43, -1, -1, sizeof(::proto::Point)},
-  { 51, -1, -1, sizeof(::proto::Rgb)},
-  { 60, -1, -1, sizeof(::proto::Rgba)},
-  { 70, -1, -1, sizeof(::proto::Color)},
-  { 80, -1, -1, sizeof(::proto::RenderSettings)},
-  { 98, -1, -1, sizeof(::proto::RoutingSettings)},
-  { 106, -1, -1, sizeof(::proto::Edge)},
-  { 115, -1, -1, sizeof(::proto::IncidenceList)},
-  { 122, -1, -1, sizeof(::proto::Graph)},
-  { 130, -1, -1, sizeof(::proto::StopVertexId)},
-  { 139, -1, -1, sizeof(::proto::EdgeInfo)},
-  { 149, -1, -1, sizeof(::proto::TransportRouter)},
-  { 159, -1, -1, sizeof(::proto::Main)},
+  { 17, -1, -1, sizeof(::proto::Distance)},
+  { 28, -1, -1, sizeof(::proto::Bus)},
+  { 43, -1, -1, sizeof(::proto::TransportCatalogue)},
+  { 54, -1, -1, sizeof(::proto::Point)},
+  { 62, -1, -1, sizeof(::proto::Rgb)},
+  { 71, -1, -1, sizeof(::proto::Rgba)},
+  { 81, -1, -1, sizeof(::proto::Color)},
+  { 91, -1, -1, sizeof(::proto::RenderSettings)},
+  { 109, -1, -1, sizeof(::proto::RoutingSettings)},
+  { 120, -1, -1, sizeof(::proto::Edge)},
+  { 129, -1, -1, sizeof(::proto::IncidenceList)},
+  { 136, -1, -1, sizeof(::proto::Graph)},
+  { 145, -1, -1, sizeof(::proto::StopVertexId)},
+  { 155, -1, -1, sizeof(::proto::EdgeInfo)},
+  { 166, -1, -1, sizeof(::proto::RoutesInternalDataRow)},
+  { 175, -1, -1, sizeof(::proto::Shortcut)},
+  { 186, -1, -1, sizeof(::proto::ContractionHierarchy)},
+  { 194, -1, -1, sizeof(::proto::TransportRouter)},
+  { 206, -1, -1, sizeof(::proto::Main)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -511,60 +633,85 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::proto::_Graph_default_instance_._instance,
   &::proto::_StopVertexId_default_instance_._instance,
   &::proto::_EdgeInfo_default_instance_._instance,
+  &::proto::_RoutesInternalDataRow_default_instance_._instance,
+  &::proto::_Shortcut_default_instance_._instance,
+  &::proto::_ContractionHierarchy_default_instance_._instance,
   &::proto::_TransportRouter_default_instance_._instance,
   &::proto::_Main_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\031transport_catalogue.proto\022\005proto\"\'\n\013Co"
-  "ordinates\022\013\n\003lat\030\001 \001(\001\022\013\n\003lng\030\002 \001(\001\"=\n\004S"
+  "ordinates\022\013\n\003lat\030\001 \001(\001\022\013\n\003lng\030\002 \001(\001\"N\n\004S"
   "top\022\014\n\004name\030\001 \001(\t\022\'\n\013coordinates\030\002 \001(\0132\022"
-  ".proto.Coordinates\"@\n\010Distance\022\021\n\tstop_f"
-  "rom\030\001 \001(\t\022\017\n\007stop_to\030\002 \001(\t\022\020\n\010distance\030\003"
-  " \001(\001\"E\n\003Bus\022\014\n\004name\030\001 \001(\t\022\032\n\005stops\030\002 \003(\013"
-  "2\013.proto.Stop\022\024\n\014is_roundtrip\030\003 \001(\010\"o\n\022T"
-  "ransportCatalogue\022\032\n\005stops\030\001 \003(\0132\013.proto"
-  ".Stop\022\"\n\tdistances\030\002 \003(\0132\017.proto.Distanc"
-  "e\022\031\n\005buses\030\003 \003(\0132\n.proto.Bus\"\035\n\005Point\022\t\n"
-  "\001x\030\001 \001(\001\022\t\n\001y\030\002 \001(\001\"/\n\003Rgb\022\013\n\003red\030\001 \001(\r\022"
-  "\r\n\005green\030\002 \001(\r\022\014\n\004blue\030\003 \001(\r\"A\n\004Rgba\022\013\n\003"
-  "red\030\001 \001(\r\022\r\n\005green\030\002 \001(\r\022\014\n\004blue\030\003 \001(\r\022\017"
-  "\n\007opacity\030\004 \001(\001\"]\n\005Color\022\022\n\ncolor_type\030\001"
-  " \001(\t\022\014\n\004name\030\002 \001(\t\022\027\n\003rgb\030\003 \001(\0132\n.proto."
-  "Rgb\022\031\n\004rgba\030\004 \001(\0132\013.proto.Rgba\"\334\002\n\016Rende"
-  "rSettings\022\r\n\005width\030\001 \001(\001\022\016\n\006height\030\002 \001(\001"
-  "\022\017\n\007padding\030\003 \001(\001\022\022\n\nline_width\030\004 \001(\001\022\023\n"
-  "\013stop_radius\030\005 \001(\001\022\033\n\023bus_label_font_siz"
-  "e\030\006 \001(\r\022&\n\020bus_label_offset\030\007 \001(\0132\014.prot"
-  "o.Point\022\034\n\024stop_label_font_size\030\010 \001(\r\022\'\n"
-  "\021stop_label_offset\030\t \001(\0132\014.proto.Point\022&"
-  "\n\020underlayer_color\030\n \001(\0132\014.proto.Color\022\030"
-  "\n\020underlayer_width\030\013 \001(\001\022#\n\rcolor_palett"
-  "e\030\014 \003(\0132\014.proto.Color\">\n\017RoutingSettings"
-  "\022\025\n\rbus_wait_time\030\001 \001(\001\022\024\n\014bus_velocity\030"
-  "\002 \001(\001\"0\n\004Edge\022\014\n\004from\030\001 \001(\r\022\n\n\002to\030\002 \001(\r\022"
-  "\016\n\006weight\030\003 \001(\001\"\035\n\rIncidenceList\022\014\n\004list"
-  "\030\001 \003(\r\"R\n\005Graph\022\032\n\005edges\030\001 \003(\0132\013.proto.E"
-  "dge\022-\n\017incidence_lists\030\002 \003(\0132\024.proto.Inc"
-  "idenceList\"B\n\014StopVertexId\022\014\n\004name\030\001 \001(\t"
-  "\022\022\n\nstart_wait\030\002 \001(\r\022\020\n\010end_wait\030\003 \001(\r\"U"
-  "\n\010EdgeInfo\022\031\n\004edge\030\001 \001(\0132\013.proto.Edge\022\014\n"
-  "\004name\030\002 \001(\t\022\022\n\nspan_count\030\003 \001(\r\022\014\n\004time\030"
-  "\004 \001(\001\"\263\001\n\017TransportRouter\0220\n\020routing_set"
-  "tings\030\001 \001(\0132\026.proto.RoutingSettings\022\033\n\005g"
-  "raph\030\002 \001(\0132\014.proto.Graph\022,\n\017stop_vertex_"
-  "ids\030\003 \003(\0132\023.proto.StopVertexId\022#\n\nedges_"
-  "info\030\004 \003(\0132\017.proto.EdgeInfo\"\240\001\n\004Main\0226\n\023"
-  "transport_catalogue\030\001 \001(\0132\031.proto.Transp"
-  "ortCatalogue\022.\n\017render_settings\030\002 \001(\0132\025."
-  "proto.RenderSettings\0220\n\020transport_router"
-  "\030\003 \001(\0132\026.proto.TransportRouterb\006proto3"
+  ".proto.Coordinates\022\017\n\007name_id\030\003 \001(\r\"j\n\010D"
+  "istance\022\021\n\tstop_from\030\001 \001(\t\022\017\n\007stop_to\030\002 "
+  "\001(\t\022\020\n\010distance\030\003 \001(\001\022\024\n\014stop_from_id\030\004 "
+  "\001(\r\022\022\n\nstop_to_id\030\005 \001(\r\"\300\001\n\003Bus\022\014\n\004name\030"
+  "\001 \001(\t\022\032\n\005stops\030\002 \003(\0132\013.proto.Stop\022\024\n\014is_"
+  "roundtrip\030\003 \001(\010\022\022\n\nstop_count\030\004 \001(\r\022\031\n\021u"
+  "nique_stop_count\030\005 \001(\r\022\024\n\014route_length\030\006"
+  " \001(\001\022\021\n\tcurvature\030\007 \001(\001\022\017\n\007name_id\030\010 \001(\r"
+  "\022\020\n\010stop_ids\030\t \003(\r\"\222\001\n\022TransportCatalogu"
+  "e\022\032\n\005stops\030\001 \003(\0132\013.proto.Stop\022\"\n\tdistanc"
+  "es\030\002 \003(\0132\017.proto.Distance\022\031\n\005buses\030\003 \003(\013"
+  "2\n.proto.Bus\022\r\n\005names\030\004 \003(\t\022\022\n\nstop_inde"
+  "x\030\005 \003(\r\"\035\n\005Point\022\t\n\001x\030\001 \001(\001\022\t\n\001y\030\002 \001(\001\"/"
+  "\n\003Rgb\022\013\n\003red\030\001 \001(\r\022\r\n\005green\030\002 \001(\r\022\014\n\004blu"
+  "e\030\003 \001(\r\"A\n\004Rgba\022\013\n\003red\030\001 \001(\r\022\r\n\005green\030\002 "
+  "\001(\r\022\014\n\004blue\030\003 \001(\r\022\017\n\007opacity\030\004 \001(\001\"]\n\005Co"
+  "lor\022\022\n\ncolor_type\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\027\n"
+  "\003rgb\030\003 \001(\0132\n.proto.Rgb\022\031\n\004rgba\030\004 \001(\0132\013.p"
+  "roto.Rgba\"\334\002\n\016RenderSettings\022\r\n\005width\030\001 "
+  "\001(\001\022\016\n\006height\030\002 \001(\001\022\017\n\007padding\030\003 \001(\001\022\022\n\n"
+  "line_width\030\004 \001(\001\022\023\n\013stop_radius\030\005 \001(\001\022\033\n"
+  "\023bus_label_font_size\030\006 \001(\r\022&\n\020bus_label_"
+  "offset\030\007 \001(\0132\014.proto.Point\022\034\n\024stop_label"
+  "_font_size\030\010 \001(\r\022\'\n\021stop_label_offset\030\t "
+  "\001(\0132\014.proto.Point\022&\n\020underlayer_color\030\n "
+  "\001(\0132\014.proto.Color\022\030\n\020underlayer_width\030\013 "
+  "\001(\001\022#\n\rcolor_palette\030\014 \003(\0132\014.proto.Color"
+  "\"\234\001\n\017RoutingSettings\022\025\n\rbus_wait_time\030\001 "
+  "\001(\001\022\024\n\014bus_velocity\030\002 \001(\001\022&\n\013router_type"
+  "\030\003 \001(\0162\021.proto.RouterType\022\030\n\020walking_vel"
+  "ocity\030\004 \001(\001\022\032\n\022walking_stop_count\030\005 \001(\r\""
+  "0\n\004Edge\022\014\n\004from\030\001 \001(\r\022\n\n\002to\030\002 \001(\r\022\016\n\006wei"
+  "ght\030\003 \001(\001\"\035\n\rIncidenceList\022\014\n\004list\030\001 \003(\r"
+  "\"h\n\005Graph\022\032\n\005edges\030\001 \003(\0132\013.proto.Edge\022-\n"
+  "\017incidence_lists\030\002 \003(\0132\024.proto.Incidence"
+  "List\022\024\n\014vertex_count\030\003 \001(\r\"S\n\014StopVertex"
+  "Id\022\014\n\004name\030\001 \001(\t\022\022\n\nstart_wait\030\002 \001(\r\022\020\n\010"
+  "end_wait\030\003 \001(\r\022\017\n\007stop_id\030\004 \001(\r\"f\n\010EdgeI"
+  "nfo\022\031\n\004edge\030\001 \001(\0132\013.proto.Edge\022\014\n\004name\030\002"
+  " \001(\t\022\022\n\nspan_count\030\003 \001(\r\022\014\n\004time\030\004 \001(\001\022\017"
+  "\n\007name_id\030\005 \001(\r\"M\n\025RoutesInternalDataRow"
+  "\022\021\n\tvertex_to\030\001 \003(\r\022\016\n\006weight\030\002 \003(\001\022\021\n\tp"
+  "rev_edge\030\003 \003(\003\"]\n\010Shortcut\022\014\n\004from\030\001 \001(\r"
+  "\022\n\n\002to\030\002 \001(\r\022\016\n\006weight\030\003 \001(\001\022\022\n\nfirst_ed"
+  "ge\030\004 \001(\r\022\023\n\013second_edge\030\005 \001(\r\"I\n\024Contrac"
+  "tionHierarchy\022\r\n\005ranks\030\001 \003(\r\022\"\n\tshortcut"
+  "s\030\002 \003(\0132\017.proto.Shortcut\"\253\002\n\017TransportRo"
+  "uter\0220\n\020routing_settings\030\001 \001(\0132\026.proto.R"
+  "outingSettings\022\033\n\005graph\030\002 \001(\0132\014.proto.Gr"
+  "aph\022,\n\017stop_vertex_ids\030\003 \003(\0132\023.proto.Sto"
+  "pVertexId\022#\n\nedges_info\030\004 \003(\0132\017.proto.Ed"
+  "geInfo\022:\n\024routes_internal_data\030\005 \003(\0132\034.p"
+  "roto.RoutesInternalDataRow\022:\n\025contractio"
+  "n_hierarchy\030\006 \001(\0132\033.proto.ContractionHie"
+  "rarchy\"\266\001\n\004Main\0226\n\023transport_catalogue\030\001"
+  " \001(\0132\031.proto.TransportCatalogue\022.\n\017rende"
+  "r_settings\030\002 \001(\0132\025.proto.RenderSettings\022"
+  "0\n\020transport_router\030\003 \001(\0132\026.proto.Transp"
+  "ortRouter\022\024\n\014rendered_map\030\004 \001(\014*u\n\nRoute"
+  "rType\022\r\n\tALL_PAIRS\020\000\022\014\n\010DIJKSTRA\020\001\022\033\n\027CO"
+  "NTRACTION_HIERARCHIES\020\002\022\026\n\022PARALLEL_ALL_"
+  "PAIRS\020\003\022\025\n\021COMPACT_ALL_PAIRS\020\004b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
-    false, false, 1718, descriptor_table_protodef_transport_5fcatalogue_2eproto,
+    false, false, 2598, descriptor_table_protodef_transport_5fcatalogue_2eproto,
     "transport_catalogue.proto",
-    &descriptor_table_transport_5fcatalogue_2eproto_once, nullptr, 0, 18,
+    &descriptor_table_transport_5fcatalogue_2eproto_once, nullptr, 0, 21,
     schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
     file_level_metadata_transport_5fcatalogue_2eproto, file_level_enum_descriptors_transport_5fcatalogue_2eproto,
     file_level_service_descriptors_transport_5fcatalogue_2eproto,
@@ -576,6 +723,23 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transpor
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5fcatalogue_2eproto(&descriptor_table_transport_5fcatalogue_2eproto);
 namespace proto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5fcatalogue_2eproto);
+  return file_level_enum_descriptors_transport_5fcatalogue_2eproto[0];
+}
+bool RouterType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -835,6 +999,7 @@ Stop::Stop(const Stop& from)
   new (&_impl_) Impl_{
       decltype(_impl_.name_){}
     , decltype(_impl_.coordinates_){nullptr}
+    , decltype(_impl_.name_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -849,6 +1014,7 @@ Stop::Stop(const Stop& from)
   if (from._internal_has_coordinates()) {
     _this->_impl_.coordinates_ = new ::proto::Coordinates(*from._impl_.coordinates_);
   }
+  _this->_impl_.name_id_ = from._impl_.name_id_;
   // @@protoc_insertion_point(copy_constructor:proto.Stop)
 }
 
@@ -859,6 +1025,7 @@ inline void Stop::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.name_){}
     , decltype(_impl_.coordinates_){nullptr}
+    , decltype(_impl_.name_id_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.name_.InitDefault();
@@ -897,6 +1064,7 @@ void Stop::Clear() {
     delete _impl_.coordinates_;
   }
   _impl_.coordinates_ = nullptr;
+  _impl_.name_id_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -924,6 +1092,14 @@ const char* Stop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // uint32 name_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.name_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -970,6 +1146,12 @@ uint8_t* Stop::_InternalSerialize(
         _Internal::coordinates(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 name_id = 3;
+  if (this->_internal_name_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_name_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1000,6 +1182,11 @@ size_t Stop::ByteSizeLong() const {
         *_impl_.coordinates_);
   }
 
+  // uint32 name_id = 3;
+  if (this->_internal_name_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_name_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1025,6 +1212,9 @@ void Stop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_
     _this->_internal_mutable_coordinates()->::proto::Coordinates::MergeFrom(
         from._internal_coordinates());
   }
+  if (from._internal_name_id() != 0) {
+    _this->_internal_set_name_id(from._internal_name_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1048,7 +1238,12 @@ void Stop::InternalSwap(Stop* other) {
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
-  swap(_impl_.coordinates_, other->_impl_.coordinates_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stop, _impl_.name_id_)
+      + sizeof(Stop::_impl_.name_id_)
+      - PROTOBUF_FIELD_OFFSET(Stop, _impl_.coordinates_)>(
+          reinterpret_cast<char*>(&_impl_.coordinates_),
+          reinterpret_cast<char*>(&other->_impl_.coordinates_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Stop::GetMetadata() const {
@@ -1076,6 +1271,8 @@ Distance::Distance(const Distance& from)
       decltype(_impl_.stop_from_){}
     , decltype(_impl_.stop_to_){}
     , decltype(_impl_.distance_){}
+    , decltype(_impl_.stop_from_id_){}
+    , decltype(_impl_.stop_to_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1095,7 +1292,9 @@ Distance::Distance(const Distance& from)
     _this->_impl_.stop_to_.Set(from._internal_stop_to(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.distance_ = from._impl_.distance_;
+  ::memcpy(&_impl_.distance_, &from._impl_.distance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stop_to_id_) -
+    reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_to_id_));
   // @@protoc_insertion_point(copy_constructor:proto.Distance)
 }
 
@@ -1107,6 +1306,8 @@ inline void Distance::SharedCtor(
       decltype(_impl_.stop_from_){}
     , decltype(_impl_.stop_to_){}
     , decltype(_impl_.distance_){0}
+    , decltype(_impl_.stop_from_id_){0u}
+    , decltype(_impl_.stop_to_id_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.stop_from_.InitDefault();
@@ -1146,7 +1347,9 @@ void Distance::Clear() {
 
   _impl_.stop_from_.ClearToEmpty();
   _impl_.stop_to_.ClearToEmpty();
-  _impl_.distance_ = 0;
+  ::memset(&_impl_.distance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stop_to_id_) -
+      reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_to_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1184,6 +1387,22 @@ const char* Distance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // uint32 stop_from_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stop_from_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 stop_to_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.stop_to_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1243,6 +1462,18 @@ uint8_t* Distance::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_distance(), target);
   }
 
+  // uint32 stop_from_id = 4;
+  if (this->_internal_stop_from_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_stop_from_id(), target);
+  }
+
+  // uint32 stop_to_id = 5;
+  if (this->_internal_stop_to_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_stop_to_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1282,6 +1513,16 @@ size_t Distance::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
+  // uint32 stop_from_id = 4;
+  if (this->_internal_stop_from_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_from_id());
+  }
+
+  // uint32 stop_to_id = 5;
+  if (this->_internal_stop_to_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_to_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1313,6 +1554,12 @@ void Distance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTO
   if (raw_distance != 0) {
     _this->_internal_set_distance(from._internal_distance());
   }
+  if (from._internal_stop_from_id() != 0) {
+    _this->_internal_set_stop_from_id(from._internal_stop_from_id());
+  }
+  if (from._internal_stop_to_id() != 0) {
+    _this->_internal_set_stop_to_id(from._internal_stop_to_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1340,7 +1587,12 @@ void Distance::InternalSwap(Distance* other) {
       &_impl_.stop_to_, lhs_arena,
       &other->_impl_.stop_to_, rhs_arena
   );
-  swap(_impl_.distance_, other->_impl_.distance_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Distance, _impl_.stop_to_id_)
+      + sizeof(Distance::_impl_.stop_to_id_)
+      - PROTOBUF_FIELD_OFFSET(Distance, _impl_.distance_)>(
+          reinterpret_cast<char*>(&_impl_.distance_),
+          reinterpret_cast<char*>(&other->_impl_.distance_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Distance::GetMetadata() const {
@@ -1366,8 +1618,15 @@ Bus::Bus(const Bus& from)
   Bus* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.stops_){from._impl_.stops_}
+    , decltype(_impl_.stop_ids_){from._impl_.stop_ids_}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
     , decltype(_impl_.name_){}
     , decltype(_impl_.is_roundtrip_){}
+    , decltype(_impl_.stop_count_){}
+    , decltype(_impl_.route_length_){}
+    , decltype(_impl_.unique_stop_count_){}
+    , decltype(_impl_.name_id_){}
+    , decltype(_impl_.curvature_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1379,7 +1638,9 @@ Bus::Bus(const Bus& from)
     _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.is_roundtrip_ = from._impl_.is_roundtrip_;
+  ::memcpy(&_impl_.is_roundtrip_, &from._impl_.is_roundtrip_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.curvature_) -
+    reinterpret_cast<char*>(&_impl_.is_roundtrip_)) + sizeof(_impl_.curvature_));
   // @@protoc_insertion_point(copy_constructor:proto.Bus)
 }
 
@@ -1389,8 +1650,15 @@ inline void Bus::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.stops_){arena}
+    , decltype(_impl_.stop_ids_){arena}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
     , decltype(_impl_.name_){}
     , decltype(_impl_.is_roundtrip_){false}
+    , decltype(_impl_.stop_count_){0u}
+    , decltype(_impl_.route_length_){0}
+    , decltype(_impl_.unique_stop_count_){0u}
+    , decltype(_impl_.name_id_){0u}
+    , decltype(_impl_.curvature_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.name_.InitDefault();
@@ -1411,6 +1679,7 @@ Bus::~Bus() {
 inline void Bus::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.stops_.~RepeatedPtrField();
+  _impl_.stop_ids_.~RepeatedField();
   _impl_.name_.Destroy();
 }
 
@@ -1425,8 +1694,11 @@ void Bus::Clear() {
   (void) cached_has_bits;
 
   _impl_.stops_.Clear();
+  _impl_.stop_ids_.Clear();
   _impl_.name_.ClearToEmpty();
-  _impl_.is_roundtrip_ = false;
+  ::memset(&_impl_.is_roundtrip_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.curvature_) -
+      reinterpret_cast<char*>(&_impl_.is_roundtrip_)) + sizeof(_impl_.curvature_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1467,6 +1739,57 @@ const char* Bus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // uint32 stop_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 unique_stop_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.unique_stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double route_length = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double curvature = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.curvature_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 name_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.name_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 stop_ids = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_stop_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_stop_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1520,6 +1843,53 @@ uint8_t* Bus::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_roundtrip(), target);
   }
 
+  // uint32 stop_count = 4;
+  if (this->_internal_stop_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_stop_count(), target);
+  }
+
+  // uint32 unique_stop_count = 5;
+  if (this->_internal_unique_stop_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_unique_stop_count(), target);
+  }
+
+  // double route_length = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = this->_internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_route_length(), target);
+  }
+
+  // double curvature = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_curvature = this->_internal_curvature();
+  uint64_t raw_curvature;
+  memcpy(&raw_curvature, &tmp_curvature, sizeof(tmp_curvature));
+  if (raw_curvature != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_curvature(), target);
+  }
+
+  // uint32 name_id = 8;
+  if (this->_internal_name_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_name_id(), target);
+  }
+
+  // repeated uint32 stop_ids = 9;
+  {
+    int byte_size = _impl_._stop_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          9, _internal_stop_ids(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1543,6 +1913,20 @@ size_t Bus::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated uint32 stop_ids = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.stop_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stop_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // string name = 1;
   if (!this->_internal_name().empty()) {
     total_size += 1 +
@@ -1555,6 +1939,39 @@ size_t Bus::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
+  // uint32 stop_count = 4;
+  if (this->_internal_stop_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_count());
+  }
+
+  // double route_length = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = this->_internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 unique_stop_count = 5;
+  if (this->_internal_unique_stop_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_stop_count());
+  }
+
+  // uint32 name_id = 8;
+  if (this->_internal_name_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_name_id());
+  }
+
+  // double curvature = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_curvature = this->_internal_curvature();
+  uint64_t raw_curvature;
+  memcpy(&raw_curvature, &tmp_curvature, sizeof(tmp_curvature));
+  if (raw_curvature != 0) {
+    total_size += 1 + 8;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1574,12 +1991,36 @@ void Bus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_N
   (void) cached_has_bits;
 
   _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_impl_.stop_ids_.MergeFrom(from._impl_.stop_ids_);
   if (!from._internal_name().empty()) {
     _this->_internal_set_name(from._internal_name());
   }
   if (from._internal_is_roundtrip() != 0) {
     _this->_internal_set_is_roundtrip(from._internal_is_roundtrip());
   }
+  if (from._internal_stop_count() != 0) {
+    _this->_internal_set_stop_count(from._internal_stop_count());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = from._internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    _this->_internal_set_route_length(from._internal_route_length());
+  }
+  if (from._internal_unique_stop_count() != 0) {
+    _this->_internal_set_unique_stop_count(from._internal_unique_stop_count());
+  }
+  if (from._internal_name_id() != 0) {
+    _this->_internal_set_name_id(from._internal_name_id());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_curvature = from._internal_curvature();
+  uint64_t raw_curvature;
+  memcpy(&raw_curvature, &tmp_curvature, sizeof(tmp_curvature));
+  if (raw_curvature != 0) {
+    _this->_internal_set_curvature(from._internal_curvature());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1600,11 +2041,17 @@ void Bus::InternalSwap(Bus* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+  _impl_.stop_ids_.InternalSwap(&other->_impl_.stop_ids_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
-  swap(_impl_.is_roundtrip_, other->_impl_.is_roundtrip_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Bus, _impl_.curvature_)
+      + sizeof(Bus::_impl_.curvature_)
+      - PROTOBUF_FIELD_OFFSET(Bus, _impl_.is_roundtrip_)>(
+          reinterpret_cast<char*>(&_impl_.is_roundtrip_),
+          reinterpret_cast<char*>(&other->_impl_.is_roundtrip_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Bus::GetMetadata() const {
@@ -1632,6 +2079,9 @@ TransportCatalogue::TransportCatalogue(const TransportCatalogue& from)
       decltype(_impl_.stops_){from._impl_.stops_}
     , decltype(_impl_.distances_){from._impl_.distances_}
     , decltype(_impl_.buses_){from._impl_.buses_}
+    , decltype(_impl_.names_){from._impl_.names_}
+    , decltype(_impl_.stop_index_){from._impl_.stop_index_}
+    , /*decltype(_impl_._stop_index_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1646,6 +2096,9 @@ inline void TransportCatalogue::SharedCtor(
       decltype(_impl_.stops_){arena}
     , decltype(_impl_.distances_){arena}
     , decltype(_impl_.buses_){arena}
+    , decltype(_impl_.names_){arena}
+    , decltype(_impl_.stop_index_){arena}
+    , /*decltype(_impl_._stop_index_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1664,6 +2117,8 @@ inline void TransportCatalogue::SharedDtor() {
   _impl_.stops_.~RepeatedPtrField();
   _impl_.distances_.~RepeatedPtrField();
   _impl_.buses_.~RepeatedPtrField();
+  _impl_.names_.~RepeatedPtrField();
+  _impl_.stop_index_.~RepeatedField();
 }
 
 void TransportCatalogue::SetCachedSize(int size) const {
@@ -1679,6 +2134,8 @@ void TransportCatalogue::Clear() {
   _impl_.stops_.Clear();
   _impl_.distances_.Clear();
   _impl_.buses_.Clear();
+  _impl_.names_.Clear();
+  _impl_.stop_index_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1727,6 +2184,32 @@ const char* TransportCatalogue::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
+      // repeated string names = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_names();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "proto.TransportCatalogue.names"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 stop_index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_stop_index(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_stop_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1780,6 +2263,25 @@ uint8_t* TransportCatalogue::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // repeated string names = 4;
+  for (int i = 0, n = this->_internal_names_size(); i < n; i++) {
+    const auto& s = this->_internal_names(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto.TransportCatalogue.names");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated uint32 stop_index = 5;
+  {
+    int byte_size = _impl_._stop_index_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_stop_index(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1817,6 +2319,28 @@ size_t TransportCatalogue::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated string names = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.names_.size());
+  for (int i = 0, n = _impl_.names_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.names_.Get(i));
+  }
+
+  // repeated uint32 stop_index = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.stop_index_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stop_index_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1838,6 +2362,8 @@ void TransportCatalogue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
   _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
   _this->_impl_.buses_.MergeFrom(from._impl_.buses_);
+  _this->_impl_.names_.MergeFrom(from._impl_.names_);
+  _this->_impl_.stop_index_.MergeFrom(from._impl_.stop_index_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1858,6 +2384,8 @@ void TransportCatalogue::InternalSwap(TransportCatalogue* other) {
   _impl_.stops_.InternalSwap(&other->_impl_.stops_);
   _impl_.distances_.InternalSwap(&other->_impl_.distances_);
   _impl_.buses_.InternalSwap(&other->_impl_.buses_);
+  _impl_.names_.InternalSwap(&other->_impl_.names_);
+  _impl_.stop_index_.InternalSwap(&other->_impl_.stop_index_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata TransportCatalogue::GetMetadata() const {
@@ -3550,12 +4078,15 @@ RoutingSettings::RoutingSettings(const RoutingSettings& from)
   new (&_impl_) Impl_{
       decltype(_impl_.bus_wait_time_){}
     , decltype(_impl_.bus_velocity_){}
+    , decltype(_impl_.walking_velocity_){}
+    , decltype(_impl_.router_type_){}
+    , decltype(_impl_.walking_stop_count_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.bus_wait_time_, &from._impl_.bus_wait_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bus_velocity_) -
-    reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.bus_velocity_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.walking_stop_count_) -
+    reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.walking_stop_count_));
   // @@protoc_insertion_point(copy_constructor:proto.RoutingSettings)
 }
 
@@ -3566,6 +4097,9 @@ inline void RoutingSettings::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.bus_wait_time_){0}
     , decltype(_impl_.bus_velocity_){0}
+    , decltype(_impl_.walking_velocity_){0}
+    , decltype(_impl_.router_type_){0}
+    , decltype(_impl_.walking_stop_count_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -3594,8 +4128,8 @@ void RoutingSettings::Clear() {
   (void) cached_has_bits;
 
   ::memset(&_impl_.bus_wait_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.bus_velocity_) -
-      reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.bus_velocity_));
+      reinterpret_cast<char*>(&_impl_.walking_stop_count_) -
+      reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.walking_stop_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3621,6 +4155,31 @@ const char* RoutingSettings::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // .proto.RouterType router_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_router_type(static_cast<::proto::RouterType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double walking_velocity = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.walking_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 walking_stop_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.walking_stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3670,6 +4229,29 @@ uint8_t* RoutingSettings::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity(), target);
   }
 
+  // .proto.RouterType router_type = 3;
+  if (this->_internal_router_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_router_type(), target);
+  }
+
+  // double walking_velocity = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_walking_velocity = this->_internal_walking_velocity();
+  uint64_t raw_walking_velocity;
+  memcpy(&raw_walking_velocity, &tmp_walking_velocity, sizeof(tmp_walking_velocity));
+  if (raw_walking_velocity != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_walking_velocity(), target);
+  }
+
+  // uint32 walking_stop_count = 5;
+  if (this->_internal_walking_stop_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_walking_stop_count(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3704,6 +4286,26 @@ size_t RoutingSettings::ByteSizeLong() const {
     total_size += 1 + 8;
   }
 
+  // double walking_velocity = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_walking_velocity = this->_internal_walking_velocity();
+  uint64_t raw_walking_velocity;
+  memcpy(&raw_walking_velocity, &tmp_walking_velocity, sizeof(tmp_walking_velocity));
+  if (raw_walking_velocity != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .proto.RouterType router_type = 3;
+  if (this->_internal_router_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_router_type());
+  }
+
+  // uint32 walking_stop_count = 5;
+  if (this->_internal_walking_stop_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_walking_stop_count());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -3736,6 +4338,19 @@ void RoutingSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (raw_bus_velocity != 0) {
     _this->_internal_set_bus_velocity(from._internal_bus_velocity());
   }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_walking_velocity = from._internal_walking_velocity();
+  uint64_t raw_walking_velocity;
+  memcpy(&raw_walking_velocity, &tmp_walking_velocity, sizeof(tmp_walking_velocity));
+  if (raw_walking_velocity != 0) {
+    _this->_internal_set_walking_velocity(from._internal_walking_velocity());
+  }
+  if (from._internal_router_type() != 0) {
+    _this->_internal_set_router_type(from._internal_router_type());
+  }
+  if (from._internal_walking_stop_count() != 0) {
+    _this->_internal_set_walking_stop_count(from._internal_walking_stop_count());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3754,8 +4369,8 @@ void RoutingSettings::InternalSwap(RoutingSettings* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.bus_velocity_)
-      + sizeof(RoutingSettings::_impl_.bus_velocity_)
+      PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.walking_stop_count_)
+      + sizeof(RoutingSettings::_impl_.walking_stop_count_)
       - PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.bus_wait_time_)>(
           reinterpret_cast<char*>(&_impl_.bus_wait_time_),
           reinterpret_cast<char*>(&other->_impl_.bus_wait_time_));
@@ -4225,9 +4840,11 @@ Graph::Graph(const Graph& from)
   new (&_impl_) Impl_{
       decltype(_impl_.edges_){from._impl_.edges_}
     , decltype(_impl_.incidence_lists_){from._impl_.incidence_lists_}
+    , decltype(_impl_.vertex_count_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.vertex_count_ = from._impl_.vertex_count_;
   // @@protoc_insertion_point(copy_constructor:proto.Graph)
 }
 
@@ -4238,6 +4855,7 @@ inline void Graph::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.edges_){arena}
     , decltype(_impl_.incidence_lists_){arena}
+    , decltype(_impl_.vertex_count_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -4269,6 +4887,7 @@ void Graph::Clear() {
 
   _impl_.edges_.Clear();
   _impl_.incidence_lists_.Clear();
+  _impl_.vertex_count_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -4304,6 +4923,14 @@ const char* Graph::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // uint32 vertex_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.vertex_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4349,6 +4976,12 @@ uint8_t* Graph::_InternalSerialize(
         InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // uint32 vertex_count = 3;
+  if (this->_internal_vertex_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_vertex_count(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4379,6 +5012,11 @@ size_t Graph::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // uint32 vertex_count = 3;
+  if (this->_internal_vertex_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_count());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4399,6 +5037,9 @@ void Graph::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
 
   _this->_impl_.edges_.MergeFrom(from._impl_.edges_);
   _this->_impl_.incidence_lists_.MergeFrom(from._impl_.incidence_lists_);
+  if (from._internal_vertex_count() != 0) {
+    _this->_internal_set_vertex_count(from._internal_vertex_count());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -4418,6 +5059,7 @@ void Graph::InternalSwap(Graph* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.edges_.InternalSwap(&other->_impl_.edges_);
   _impl_.incidence_lists_.InternalSwap(&other->_impl_.incidence_lists_);
+  swap(_impl_.vertex_count_, other->_impl_.vertex_count_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Graph::GetMetadata() const {
@@ -4445,6 +5087,7 @@ StopVertexId::StopVertexId(const StopVertexId& from)
       decltype(_impl_.name_){}
     , decltype(_impl_.start_wait_){}
     , decltype(_impl_.end_wait_){}
+    , decltype(_impl_.stop_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -4457,8 +5100,8 @@ StopVertexId::StopVertexId(const StopVertexId& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.start_wait_, &from._impl_.start_wait_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_wait_) -
-    reinterpret_cast<char*>(&_impl_.start_wait_)) + sizeof(_impl_.end_wait_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stop_id_) -
+    reinterpret_cast<char*>(&_impl_.start_wait_)) + sizeof(_impl_.stop_id_));
   // @@protoc_insertion_point(copy_constructor:proto.StopVertexId)
 }
 
@@ -4470,6 +5113,7 @@ inline void StopVertexId::SharedCtor(
       decltype(_impl_.name_){}
     , decltype(_impl_.start_wait_){0u}
     , decltype(_impl_.end_wait_){0u}
+    , decltype(_impl_.stop_id_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.name_.InitDefault();
@@ -4504,8 +5148,8 @@ void StopVertexId::Clear() {
 
   _impl_.name_.ClearToEmpty();
   ::memset(&_impl_.start_wait_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.end_wait_) -
-      reinterpret_cast<char*>(&_impl_.start_wait_)) + sizeof(_impl_.end_wait_));
+      reinterpret_cast<char*>(&_impl_.stop_id_) -
+      reinterpret_cast<char*>(&_impl_.start_wait_)) + sizeof(_impl_.stop_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -4541,6 +5185,14 @@ const char* StopVertexId::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // uint32 stop_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stop_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4592,6 +5244,12 @@ uint8_t* StopVertexId::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_end_wait(), target);
   }
 
+  // uint32 stop_id = 4;
+  if (this->_internal_stop_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_stop_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4625,6 +5283,11 @@ size_t StopVertexId::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_end_wait());
   }
 
+  // uint32 stop_id = 4;
+  if (this->_internal_stop_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_id());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4652,6 +5315,9 @@ void StopVertexId::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (from._internal_end_wait() != 0) {
     _this->_internal_set_end_wait(from._internal_end_wait());
   }
+  if (from._internal_stop_id() != 0) {
+    _this->_internal_set_stop_id(from._internal_stop_id());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -4676,8 +5342,8 @@ void StopVertexId::InternalSwap(StopVertexId* other) {
       &other->_impl_.name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(StopVertexId, _impl_.end_wait_)
-      + sizeof(StopVertexId::_impl_.end_wait_)
+      PROTOBUF_FIELD_OFFSET(StopVertexId, _impl_.stop_id_)
+      + sizeof(StopVertexId::_impl_.stop_id_)
       - PROTOBUF_FIELD_OFFSET(StopVertexId, _impl_.start_wait_)>(
           reinterpret_cast<char*>(&_impl_.start_wait_),
           reinterpret_cast<char*>(&other->_impl_.start_wait_));
@@ -4704,55 +5370,933 @@ EdgeInfo::EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:proto.EdgeInfo)
+  // @@protoc_insertion_point(arena_constructor:proto.EdgeInfo)
+}
+EdgeInfo::EdgeInfo(const EdgeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.edge_){nullptr}
+    , decltype(_impl_.time_){}
+    , decltype(_impl_.span_count_){}
+    , decltype(_impl_.name_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_edge()) {
+    _this->_impl_.edge_ = new ::proto::Edge(*from._impl_.edge_);
+  }
+  ::memcpy(&_impl_.time_, &from._impl_.time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.name_id_) -
+    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.name_id_));
+  // @@protoc_insertion_point(copy_constructor:proto.EdgeInfo)
+}
+
+inline void EdgeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.edge_){nullptr}
+    , decltype(_impl_.time_){0}
+    , decltype(_impl_.span_count_){0u}
+    , decltype(_impl_.name_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EdgeInfo::~EdgeInfo() {
+  // @@protoc_insertion_point(destructor:proto.EdgeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EdgeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.edge_;
+}
+
+void EdgeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EdgeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.EdgeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.edge_ != nullptr) {
+    delete _impl_.edge_;
+  }
+  _impl_.edge_ = nullptr;
+  ::memset(&_impl_.time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.name_id_) -
+      reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.name_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto.Edge edge = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_edge(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto.EdgeInfo.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 span_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 name_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.name_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EdgeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.EdgeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto.Edge edge = 1;
+  if (this->_internal_has_edge()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::edge(this),
+        _Internal::edge(this).GetCachedSize(), target, stream);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto.EdgeInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // uint32 span_count = 3;
+  if (this->_internal_span_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_span_count(), target);
+  }
+
+  // double time = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = this->_internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_time(), target);
+  }
+
+  // uint32 name_id = 5;
+  if (this->_internal_name_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_name_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.EdgeInfo)
+  return target;
+}
+
+size_t EdgeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.EdgeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .proto.Edge edge = 1;
+  if (this->_internal_has_edge()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.edge_);
+  }
+
+  // double time = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = this->_internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 span_count = 3;
+  if (this->_internal_span_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_span_count());
+  }
+
+  // uint32 name_id = 5;
+  if (this->_internal_name_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_name_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EdgeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeInfo::GetClassData() const { return &_class_data_; }
+
+
+void EdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeInfo*>(&to_msg);
+  auto& from = static_cast<const EdgeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.EdgeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_edge()) {
+    _this->_internal_mutable_edge()->::proto::Edge::MergeFrom(
+        from._internal_edge());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time = from._internal_time();
+  uint64_t raw_time;
+  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
+  if (raw_time != 0) {
+    _this->_internal_set_time(from._internal_time());
+  }
+  if (from._internal_span_count() != 0) {
+    _this->_internal_set_span_count(from._internal_span_count());
+  }
+  if (from._internal_name_id() != 0) {
+    _this->_internal_set_name_id(from._internal_name_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EdgeInfo::CopyFrom(const EdgeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.EdgeInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EdgeInfo::IsInitialized() const {
+  return true;
+}
+
+void EdgeInfo::InternalSwap(EdgeInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EdgeInfo, _impl_.name_id_)
+      + sizeof(EdgeInfo::_impl_.name_id_)
+      - PROTOBUF_FIELD_OFFSET(EdgeInfo, _impl_.edge_)>(
+          reinterpret_cast<char*>(&_impl_.edge_),
+          reinterpret_cast<char*>(&other->_impl_.edge_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EdgeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[15]);
+}
+
+// ===================================================================
+
+class RoutesInternalDataRow::_Internal {
+ public:
+};
+
+RoutesInternalDataRow::RoutesInternalDataRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.RoutesInternalDataRow)
+}
+RoutesInternalDataRow::RoutesInternalDataRow(const RoutesInternalDataRow& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutesInternalDataRow* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_to_){from._impl_.vertex_to_}
+    , /*decltype(_impl_._vertex_to_cached_byte_size_)*/{0}
+    , decltype(_impl_.weight_){from._impl_.weight_}
+    , decltype(_impl_.prev_edge_){from._impl_.prev_edge_}
+    , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.RoutesInternalDataRow)
+}
+
+inline void RoutesInternalDataRow::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_to_){arena}
+    , /*decltype(_impl_._vertex_to_cached_byte_size_)*/{0}
+    , decltype(_impl_.weight_){arena}
+    , decltype(_impl_.prev_edge_){arena}
+    , /*decltype(_impl_._prev_edge_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoutesInternalDataRow::~RoutesInternalDataRow() {
+  // @@protoc_insertion_point(destructor:proto.RoutesInternalDataRow)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoutesInternalDataRow::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vertex_to_.~RepeatedField();
+  _impl_.weight_.~RepeatedField();
+  _impl_.prev_edge_.~RepeatedField();
+}
+
+void RoutesInternalDataRow::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoutesInternalDataRow::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.RoutesInternalDataRow)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.vertex_to_.Clear();
+  _impl_.weight_.Clear();
+  _impl_.prev_edge_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoutesInternalDataRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 vertex_to = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_vertex_to(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_vertex_to(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double weight = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_weight(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 17) {
+          _internal_add_weight(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 prev_edge = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_prev_edge(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_prev_edge(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoutesInternalDataRow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.RoutesInternalDataRow)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 vertex_to = 1;
+  {
+    int byte_size = _impl_._vertex_to_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_vertex_to(), byte_size, target);
+    }
+  }
+
+  // repeated double weight = 2;
+  if (this->_internal_weight_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_weight(), target);
+  }
+
+  // repeated int64 prev_edge = 3;
+  {
+    int byte_size = _impl_._prev_edge_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          3, _internal_prev_edge(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.RoutesInternalDataRow)
+  return target;
+}
+
+size_t RoutesInternalDataRow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.RoutesInternalDataRow)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 vertex_to = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.vertex_to_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._vertex_to_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double weight = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_weight_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int64 prev_edge = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.prev_edge_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._prev_edge_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutesInternalDataRow::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutesInternalDataRow::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutesInternalDataRow::GetClassData() const { return &_class_data_; }
+
+
+void RoutesInternalDataRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutesInternalDataRow*>(&to_msg);
+  auto& from = static_cast<const RoutesInternalDataRow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.RoutesInternalDataRow)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.vertex_to_.MergeFrom(from._impl_.vertex_to_);
+  _this->_impl_.weight_.MergeFrom(from._impl_.weight_);
+  _this->_impl_.prev_edge_.MergeFrom(from._impl_.prev_edge_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoutesInternalDataRow::CopyFrom(const RoutesInternalDataRow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.RoutesInternalDataRow)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoutesInternalDataRow::IsInitialized() const {
+  return true;
+}
+
+void RoutesInternalDataRow::InternalSwap(RoutesInternalDataRow* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.vertex_to_.InternalSwap(&other->_impl_.vertex_to_);
+  _impl_.weight_.InternalSwap(&other->_impl_.weight_);
+  _impl_.prev_edge_.InternalSwap(&other->_impl_.prev_edge_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoutesInternalDataRow::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[16]);
+}
+
+// ===================================================================
+
+class Shortcut::_Internal {
+ public:
+};
+
+Shortcut::Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Shortcut)
+}
+Shortcut::Shortcut(const Shortcut& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Shortcut* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.first_edge_){}
+    , decltype(_impl_.second_edge_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.second_edge_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_edge_));
+  // @@protoc_insertion_point(copy_constructor:proto.Shortcut)
+}
+
+inline void Shortcut::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , decltype(_impl_.first_edge_){0u}
+    , decltype(_impl_.second_edge_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Shortcut::~Shortcut() {
+  // @@protoc_insertion_point(destructor:proto.Shortcut)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Shortcut::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Shortcut::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Shortcut::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Shortcut)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.second_edge_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_edge_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Shortcut::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 from = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 to = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double weight = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 first_edge = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.first_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 second_edge = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.second_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Shortcut::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Shortcut)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
+  }
+
+  // uint32 first_edge = 4;
+  if (this->_internal_first_edge() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_first_edge(), target);
+  }
+
+  // uint32 second_edge = 5;
+  if (this->_internal_second_edge() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_second_edge(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Shortcut)
+  return target;
+}
+
+size_t Shortcut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Shortcut)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 first_edge = 4;
+  if (this->_internal_first_edge() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_first_edge());
+  }
+
+  // uint32 second_edge = 5;
+  if (this->_internal_second_edge() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_second_edge());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Shortcut::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Shortcut::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Shortcut::GetClassData() const { return &_class_data_; }
+
+
+void Shortcut::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Shortcut*>(&to_msg);
+  auto& from = static_cast<const Shortcut&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Shortcut)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
+  }
+  if (from._internal_to() != 0) {
+    _this->_internal_set_to(from._internal_to());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = from._internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    _this->_internal_set_weight(from._internal_weight());
+  }
+  if (from._internal_first_edge() != 0) {
+    _this->_internal_set_first_edge(from._internal_first_edge());
+  }
+  if (from._internal_second_edge() != 0) {
+    _this->_internal_set_second_edge(from._internal_second_edge());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Shortcut::CopyFrom(const Shortcut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Shortcut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Shortcut::IsInitialized() const {
+  return true;
+}
+
+void Shortcut::InternalSwap(Shortcut* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.second_edge_)
+      + sizeof(Shortcut::_impl_.second_edge_)
+      - PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Shortcut::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[17]);
+}
+
+// ===================================================================
+
+class ContractionHierarchy::_Internal {
+ public:
+};
+
+ContractionHierarchy::ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.ContractionHierarchy)
 }
-EdgeInfo::EdgeInfo(const EdgeInfo& from)
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  EdgeInfo* const _this = this; (void)_this;
+  ContractionHierarchy* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.name_){}
-    , decltype(_impl_.edge_){nullptr}
-    , decltype(_impl_.time_){}
-    , decltype(_impl_.span_count_){}
+      decltype(_impl_.ranks_){from._impl_.ranks_}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){from._impl_.shortcuts_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_name().empty()) {
-    _this->_impl_.name_.Set(from._internal_name(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_edge()) {
-    _this->_impl_.edge_ = new ::proto::Edge(*from._impl_.edge_);
-  }
-  ::memcpy(&_impl_.time_, &from._impl_.time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.span_count_) -
-    reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.span_count_));
-  // @@protoc_insertion_point(copy_constructor:proto.EdgeInfo)
+  // @@protoc_insertion_point(copy_constructor:proto.ContractionHierarchy)
 }
 
-inline void EdgeInfo::SharedCtor(
+inline void ContractionHierarchy::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.name_){}
-    , decltype(_impl_.edge_){nullptr}
-    , decltype(_impl_.time_){0}
-    , decltype(_impl_.span_count_){0u}
+      decltype(_impl_.ranks_){arena}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-EdgeInfo::~EdgeInfo() {
-  // @@protoc_insertion_point(destructor:proto.EdgeInfo)
+ContractionHierarchy::~ContractionHierarchy() {
+  // @@protoc_insertion_point(destructor:proto.ContractionHierarchy)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4760,70 +6304,54 @@ EdgeInfo::~EdgeInfo() {
   SharedDtor();
 }
 
-inline void EdgeInfo::SharedDtor() {
+inline void ContractionHierarchy::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.name_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.edge_;
+  _impl_.ranks_.~RepeatedField();
+  _impl_.shortcuts_.~RepeatedPtrField();
 }
 
-void EdgeInfo::SetCachedSize(int size) const {
+void ContractionHierarchy::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void EdgeInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.EdgeInfo)
+void ContractionHierarchy::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.ContractionHierarchy)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.name_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.edge_ != nullptr) {
-    delete _impl_.edge_;
-  }
-  _impl_.edge_ = nullptr;
-  ::memset(&_impl_.time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.span_count_) -
-      reinterpret_cast<char*>(&_impl_.time_)) + sizeof(_impl_.span_count_));
+  _impl_.ranks_.Clear();
+  _impl_.shortcuts_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ContractionHierarchy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .proto.Edge edge = 1;
+      // repeated uint32 ranks = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_edge(), ptr);
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ranks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_ranks(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string name = 2;
+      // repeated .proto.Shortcut shortcuts = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "proto.EdgeInfo.name"));
-        } else
-          goto handle_unusual;
-        continue;
-      // uint32 span_count = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // double time = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
-          _impl_.time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_shortcuts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4850,159 +6378,111 @@ failure:
 #undef CHK_
 }
 
-uint8_t* EdgeInfo::_InternalSerialize(
+uint8_t* ContractionHierarchy::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.EdgeInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.ContractionHierarchy)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .proto.Edge edge = 1;
-  if (this->_internal_has_edge()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::edge(this),
-        _Internal::edge(this).GetCachedSize(), target, stream);
-  }
-
-  // string name = 2;
-  if (!this->_internal_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "proto.EdgeInfo.name");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_name(), target);
-  }
-
-  // uint32 span_count = 3;
-  if (this->_internal_span_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_span_count(), target);
+  // repeated uint32 ranks = 1;
+  {
+    int byte_size = _impl_._ranks_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_ranks(), byte_size, target);
+    }
   }
 
-  // double time = 4;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_time = this->_internal_time();
-  uint64_t raw_time;
-  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
-  if (raw_time != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_time(), target);
+  // repeated .proto.Shortcut shortcuts = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_shortcuts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_shortcuts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.EdgeInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.ContractionHierarchy)
   return target;
 }
 
-size_t EdgeInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.EdgeInfo)
+size_t ContractionHierarchy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.ContractionHierarchy)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string name = 2;
-  if (!this->_internal_name().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
-  }
-
-  // .proto.Edge edge = 1;
-  if (this->_internal_has_edge()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.edge_);
-  }
-
-  // double time = 4;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_time = this->_internal_time();
-  uint64_t raw_time;
-  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
-  if (raw_time != 0) {
-    total_size += 1 + 8;
+  // repeated uint32 ranks = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ranks_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ranks_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // uint32 span_count = 3;
-  if (this->_internal_span_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_span_count());
+  // repeated .proto.Shortcut shortcuts = 2;
+  total_size += 1UL * this->_internal_shortcuts_size();
+  for (const auto& msg : this->_impl_.shortcuts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeInfo::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContractionHierarchy::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    EdgeInfo::MergeImpl
+    ContractionHierarchy::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeInfo::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContractionHierarchy::GetClassData() const { return &_class_data_; }
 
 
-void EdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<EdgeInfo*>(&to_msg);
-  auto& from = static_cast<const EdgeInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:proto.EdgeInfo)
+void ContractionHierarchy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContractionHierarchy*>(&to_msg);
+  auto& from = static_cast<const ContractionHierarchy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.ContractionHierarchy)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
-  }
-  if (from._internal_has_edge()) {
-    _this->_internal_mutable_edge()->::proto::Edge::MergeFrom(
-        from._internal_edge());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_time = from._internal_time();
-  uint64_t raw_time;
-  memcpy(&raw_time, &tmp_time, sizeof(tmp_time));
-  if (raw_time != 0) {
-    _this->_internal_set_time(from._internal_time());
-  }
-  if (from._internal_span_count() != 0) {
-    _this->_internal_set_span_count(from._internal_span_count());
-  }
+  _this->_impl_.ranks_.MergeFrom(from._impl_.ranks_);
+  _this->_impl_.shortcuts_.MergeFrom(from._impl_.shortcuts_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EdgeInfo::CopyFrom(const EdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.EdgeInfo)
+void ContractionHierarchy::CopyFrom(const ContractionHierarchy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.ContractionHierarchy)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EdgeInfo::IsInitialized() const {
+bool ContractionHierarchy::IsInitialized() const {
   return true;
 }
 
-void EdgeInfo::InternalSwap(EdgeInfo* other) {
+void ContractionHierarchy::InternalSwap(ContractionHierarchy* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.name_, lhs_arena,
-      &other->_impl_.name_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EdgeInfo, _impl_.span_count_)
-      + sizeof(EdgeInfo::_impl_.span_count_)
-      - PROTOBUF_FIELD_OFFSET(EdgeInfo, _impl_.edge_)>(
-          reinterpret_cast<char*>(&_impl_.edge_),
-          reinterpret_cast<char*>(&other->_impl_.edge_));
+  _impl_.ranks_.InternalSwap(&other->_impl_.ranks_);
+  _impl_.shortcuts_.InternalSwap(&other->_impl_.shortcuts_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata EdgeInfo::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ContractionHierarchy::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
-      file_level_metadata_transport_5fcatalogue_2eproto[15]);
+      file_level_metadata_transport_5fcatalogue_2eproto[18]);
 }
 
 // ===================================================================
@@ -5011,6 +6491,7 @@ class TransportRouter::_Internal {
  public:
   static const ::proto::RoutingSettings& routing_settings(const TransportRouter* msg);
   static const ::proto::Graph& graph(const TransportRouter* msg);
+  static const ::proto::ContractionHierarchy& contraction_hierarchy(const TransportRouter* msg);
 };
 
 const ::proto::RoutingSettings&
@@ -5021,6 +6502,10 @@ const ::proto::Graph&
 TransportRouter::_Internal::graph(const TransportRouter* msg) {
   return *msg->_impl_.graph_;
 }
+const ::proto::ContractionHierarchy&
+TransportRouter::_Internal::contraction_hierarchy(const TransportRouter* msg) {
+  return *msg->_impl_.contraction_hierarchy_;
+}
 TransportRouter::TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -5033,8 +6518,10 @@ TransportRouter::TransportRouter(const TransportRouter& from)
   new (&_impl_) Impl_{
       decltype(_impl_.stop_vertex_ids_){from._impl_.stop_vertex_ids_}
     , decltype(_impl_.edges_info_){from._impl_.edges_info_}
+    , decltype(_impl_.routes_internal_data_){from._impl_.routes_internal_data_}
     , decltype(_impl_.routing_settings_){nullptr}
     , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.contraction_hierarchy_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -5044,6 +6531,9 @@ TransportRouter::TransportRouter(const TransportRouter& from)
   if (from._internal_has_graph()) {
     _this->_impl_.graph_ = new ::proto::Graph(*from._impl_.graph_);
   }
+  if (from._internal_has_contraction_hierarchy()) {
+    _this->_impl_.contraction_hierarchy_ = new ::proto::ContractionHierarchy(*from._impl_.contraction_hierarchy_);
+  }
   // @@protoc_insertion_point(copy_constructor:proto.TransportRouter)
 }
 
@@ -5054,8 +6544,10 @@ inline void TransportRouter::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.stop_vertex_ids_){arena}
     , decltype(_impl_.edges_info_){arena}
+    , decltype(_impl_.routes_internal_data_){arena}
     , decltype(_impl_.routing_settings_){nullptr}
     , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.contraction_hierarchy_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -5073,8 +6565,10 @@ inline void TransportRouter::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.stop_vertex_ids_.~RepeatedPtrField();
   _impl_.edges_info_.~RepeatedPtrField();
+  _impl_.routes_internal_data_.~RepeatedPtrField();
   if (this != internal_default_instance()) delete _impl_.routing_settings_;
   if (this != internal_default_instance()) delete _impl_.graph_;
+  if (this != internal_default_instance()) delete _impl_.contraction_hierarchy_;
 }
 
 void TransportRouter::SetCachedSize(int size) const {
@@ -5089,6 +6583,7 @@ void TransportRouter::Clear() {
 
   _impl_.stop_vertex_ids_.Clear();
   _impl_.edges_info_.Clear();
+  _impl_.routes_internal_data_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.routing_settings_ != nullptr) {
     delete _impl_.routing_settings_;
   }
@@ -5097,6 +6592,10 @@ void TransportRouter::Clear() {
     delete _impl_.graph_;
   }
   _impl_.graph_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.contraction_hierarchy_ != nullptr) {
+    delete _impl_.contraction_hierarchy_;
+  }
+  _impl_.contraction_hierarchy_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -5148,6 +6647,27 @@ const char* TransportRouter::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // repeated .proto.RoutesInternalDataRow routes_internal_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_routes_internal_data(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.ContractionHierarchy contraction_hierarchy = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_contraction_hierarchy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5207,6 +6727,21 @@ uint8_t* TransportRouter::_InternalSerialize(
         InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // repeated .proto.RoutesInternalDataRow routes_internal_data = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_routes_internal_data_size()); i < n; i++) {
+    const auto& repfield = this->_internal_routes_internal_data(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .proto.ContractionHierarchy contraction_hierarchy = 6;
+  if (this->_internal_has_contraction_hierarchy()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::contraction_hierarchy(this),
+        _Internal::contraction_hierarchy(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -5237,6 +6772,13 @@ size_t TransportRouter::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .proto.RoutesInternalDataRow routes_internal_data = 5;
+  total_size += 1UL * this->_internal_routes_internal_data_size();
+  for (const auto& msg : this->_impl_.routes_internal_data_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // .proto.RoutingSettings routing_settings = 1;
   if (this->_internal_has_routing_settings()) {
     total_size += 1 +
@@ -5251,6 +6793,13 @@ size_t TransportRouter::ByteSizeLong() const {
         *_impl_.graph_);
   }
 
+  // .proto.ContractionHierarchy contraction_hierarchy = 6;
+  if (this->_internal_has_contraction_hierarchy()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.contraction_hierarchy_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -5271,6 +6820,7 @@ void TransportRouter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
 
   _this->_impl_.stop_vertex_ids_.MergeFrom(from._impl_.stop_vertex_ids_);
   _this->_impl_.edges_info_.MergeFrom(from._impl_.edges_info_);
+  _this->_impl_.routes_internal_data_.MergeFrom(from._impl_.routes_internal_data_);
   if (from._internal_has_routing_settings()) {
     _this->_internal_mutable_routing_settings()->::proto::RoutingSettings::MergeFrom(
         from._internal_routing_settings());
@@ -5279,6 +6829,10 @@ void TransportRouter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
     _this->_internal_mutable_graph()->::proto::Graph::MergeFrom(
         from._internal_graph());
   }
+  if (from._internal_has_contraction_hierarchy()) {
+    _this->_internal_mutable_contraction_hierarchy()->::proto::ContractionHierarchy::MergeFrom(
+        from._internal_contraction_hierarchy());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -5298,9 +6852,10 @@ void TransportRouter::InternalSwap(TransportRouter* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.stop_vertex_ids_.InternalSwap(&other->_impl_.stop_vertex_ids_);
   _impl_.edges_info_.InternalSwap(&other->_impl_.edges_info_);
+  _impl_.routes_internal_data_.InternalSwap(&other->_impl_.routes_internal_data_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TransportRouter, _impl_.graph_)
-      + sizeof(TransportRouter::_impl_.graph_)
+      PROTOBUF_FIELD_OFFSET(TransportRouter, _impl_.contraction_hierarchy_)
+      + sizeof(TransportRouter::_impl_.contraction_hierarchy_)
       - PROTOBUF_FIELD_OFFSET(TransportRouter, _impl_.routing_settings_)>(
           reinterpret_cast<char*>(&_impl_.routing_settings_),
           reinterpret_cast<char*>(&other->_impl_.routing_settings_));
@@ -5309,7 +6864,7 @@ void TransportRouter::InternalSwap(TransportRouter* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata TransportRouter::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
-      file_level_metadata_transport_5fcatalogue_2eproto[16]);
+      file_level_metadata_transport_5fcatalogue_2eproto[19]);
 }
 
 // ===================================================================
@@ -5343,12 +6898,21 @@ Main::Main(const Main& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   Main* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.transport_catalogue_){nullptr}
+      decltype(_impl_.rendered_map_){}
+    , decltype(_impl_.transport_catalogue_){nullptr}
     , decltype(_impl_.render_settings_){nullptr}
     , decltype(_impl_.transport_router_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rendered_map_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rendered_map_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rendered_map().empty()) {
+    _this->_impl_.rendered_map_.Set(from._internal_rendered_map(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_transport_catalogue()) {
     _this->_impl_.transport_catalogue_ = new ::proto::TransportCatalogue(*from._impl_.transport_catalogue_);
   }
@@ -5366,11 +6930,16 @@ inline void Main::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.transport_catalogue_){nullptr}
+      decltype(_impl_.rendered_map_){}
+    , decltype(_impl_.transport_catalogue_){nullptr}
     , decltype(_impl_.render_settings_){nullptr}
     , decltype(_impl_.transport_router_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.rendered_map_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rendered_map_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Main::~Main() {
@@ -5384,6 +6953,7 @@ Main::~Main() {
 
 inline void Main::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rendered_map_.Destroy();
   if (this != internal_default_instance()) delete _impl_.transport_catalogue_;
   if (this != internal_default_instance()) delete _impl_.render_settings_;
   if (this != internal_default_instance()) delete _impl_.transport_router_;
@@ -5399,6 +6969,7 @@ void Main::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.rendered_map_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && _impl_.transport_catalogue_ != nullptr) {
     delete _impl_.transport_catalogue_;
   }
@@ -5444,6 +7015,15 @@ const char* Main::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // bytes rendered_map = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_rendered_map();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5494,6 +7074,12 @@ uint8_t* Main::_InternalSerialize(
         _Internal::transport_router(this).GetCachedSize(), target, stream);
   }
 
+  // bytes rendered_map = 4;
+  if (!this->_internal_rendered_map().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_rendered_map(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -5510,6 +7096,13 @@ size_t Main::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // bytes rendered_map = 4;
+  if (!this->_internal_rendered_map().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_rendered_map());
+  }
+
   // .proto.TransportCatalogue transport_catalogue = 1;
   if (this->_internal_has_transport_catalogue()) {
     total_size += 1 +
@@ -5549,6 +7142,9 @@ void Main::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_rendered_map().empty()) {
+    _this->_internal_set_rendered_map(from._internal_rendered_map());
+  }
   if (from._internal_has_transport_catalogue()) {
     _this->_internal_mutable_transport_catalogue()->::proto::TransportCatalogue::MergeFrom(
         from._internal_transport_catalogue());
@@ -5577,7 +7173,13 @@ bool Main::IsInitialized() const {
 
 void Main::InternalSwap(Main* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rendered_map_, lhs_arena,
+      &other->_impl_.rendered_map_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(Main, _impl_.transport_router_)
       + sizeof(Main::_impl_.transport_router_)
@@ -5589,7 +7191,7 @@ void Main::InternalSwap(Main* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Main::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
-      file_level_metadata_transport_5fcatalogue_2eproto[17]);
+      file_level_metadata_transport_5fcatalogue_2eproto[20]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -5659,6 +7261,18 @@ template<> PROTOBUF_NOINLINE ::proto::EdgeInfo*
 Arena::CreateMaybeMessage< ::proto::EdgeInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::EdgeInfo >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto::RoutesInternalDataRow*
+Arena::CreateMaybeMessage< ::proto::RoutesInternalDataRow >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::RoutesInternalDataRow >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::Shortcut*
+Arena::CreateMaybeMessage< ::proto::Shortcut >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Shortcut >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::ContractionHierarchy*
+Arena::CreateMaybeMessage< ::proto::ContractionHierarchy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::ContractionHierarchy >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proto::TransportRouter*
 Arena::CreateMaybeMessage< ::proto::TransportRouter >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::TransportRouter >(arena);
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -51,6 +52,9 @@ extern BusDefaultTypeInternal _Bus_default_instance_;
 class Color;
 struct ColorDefaultTypeInternal;
 extern ColorDefaultTypeInternal _Color_default_instance_;
+class ContractionHierarchy;
+struct ContractionHierarchyDefaultTypeInternal;
+extern ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
 class Coordinates;
 struct CoordinatesDefaultTypeInternal;
 extern CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
@@ -84,9 +88,15 @@ extern RgbDefaultTypeInternal _Rgb_default_instance_;
 class Rgba;
 struct RgbaDefaultTypeInternal;
 extern RgbaDefaultTypeInternal _Rgba_default_instance_;
+class RoutesInternalDataRow;
+struct RoutesInternalDataRowDefaultTypeInternal;
+extern RoutesInternalDataRowDefaultTypeInternal _RoutesInternalDataRow_default_instance_;
 class RoutingSettings;
 struct RoutingSettingsDefaultTypeInternal;
 extern RoutingSettingsDefaultTypeInternal _RoutingSettings_default_instance_;
+class Shortcut;
+struct ShortcutDefaultTypeInternal;
+extern ShortcutDefaultTypeInternal _Shortcut_default_instance_;
 class Stop;
 struct StopDefaultTypeInternal;
 extern StopDefaultTypeInternal _Stop_default_instance_;
@@ -103,6 +113,7 @@ extern TransportRouterDefaultTypeInternal _TransportRouter_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
 template<> ::proto::Bus* Arena::CreateMaybeMessage<::proto::Bus>(Arena*);
 template<> ::proto::Color* Arena::CreateMaybeMessage<::proto::Color>(Arena*);
+template<> ::proto::ContractionHierarchy* Arena::CreateMaybeMessage<::proto::ContractionHierarchy>(Arena*);
 template<> ::proto::Coordinates* Arena::CreateMaybeMessage<::proto::Coordinates>(Arena*);
 template<> ::proto::Distance* Arena::CreateMaybeMessage<::proto::Distance>(Arena*);
 template<> ::proto::Edge* Arena::CreateMaybeMessage<::proto::Edge>(Arena*);
@@ -114,7 +125,9 @@ template<> ::proto::Point* Arena::CreateMaybeMessage<::proto::Point>(Arena*);
 template<> ::proto::RenderSettings* Arena::CreateMaybeMessage<::proto::RenderSettings>(Arena*);
 template<> ::proto::Rgb* Arena::CreateMaybeMessage<::proto::Rgb>(Arena*);
 template<> ::proto::Rgba* Arena::CreateMaybeMessage<::proto::Rgba>(Arena*);
+template<> ::proto::RoutesInternalDataRow* Arena::CreateMaybeMessage<::proto::RoutesInternalDataRow>(Arena*);
 template<> ::proto::RoutingSettings* Arena::CreateMaybeMessage<::proto::RoutingSettings>(Arena*);
+template<> ::proto::Shortcut* Arena::CreateMaybeMessage<::proto::Shortcut>(Arena*);
 template<> ::proto::Stop* Arena::CreateMaybeMessage<::proto::Stop>(Arena*);
 template<> ::proto::StopVertexId* Arena::CreateMaybeMessage<::proto::StopVertexId>(Arena*);
 template<> ::proto::TransportCatalogue* Arena::CreateMaybeMessage<::proto::TransportCatalogue>(Arena*);
@@ -122,6 +135,34 @@ template<> ::proto::TransportRouter* Arena::CreateMaybeMessage<::proto::Transpor
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto {
 
+enum RouterType : int {
+  ALL_PAIRS = 0,
+  DIJKSTRA = 1,
+  CONTRACTION_HIERARCHIES = 2,
+  PARALLEL_ALL_PAIRS = 3,
+  COMPACT_ALL_PAIRS = 4,
+  RouterType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RouterType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RouterType_IsValid(int value);
+constexpr RouterType RouterType_MIN = ALL_PAIRS;
+constexpr RouterType RouterType_MAX = COMPACT_ALL_PAIRS;
+constexpr int RouterType_ARRAYSIZE = RouterType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterType_descriptor();
+template<typename T>
+inline const std::string& RouterType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RouterType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RouterType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RouterType_descriptor(), enum_t_value);
+}
+inline bool RouterType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RouterType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RouterType>(
+    RouterType_descriptor(), name, value);
+}
 // ===================================================================
 
 class Coordinates final :
@@ -406,6 +447,7 @@ class Stop final :
   enum : int {
     kNameFieldNumber = 1,
     kCoordinatesFieldNumber = 2,
+    kNameIdFieldNumber = 3,
   };
   // string name = 1;
   void clear_name();
@@ -439,6 +481,15 @@ class Stop final :
       ::proto::Coordinates* coordinates);
   ::proto::Coordinates* unsafe_arena_release_coordinates();
 
+  // uint32 name_id = 3;
+  void clear_name_id();
+  uint32_t name_id() const;
+  void set_name_id(uint32_t value);
+  private:
+  uint32_t _internal_name_id() const;
+  void _internal_set_name_id(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Stop)
  private:
   class _Internal;
@@ -449,6 +500,7 @@ class Stop final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::proto::Coordinates* coordinates_;
+    uint32_t name_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -580,6 +632,8 @@ class Distance final :
     kStopFromFieldNumber = 1,
     kStopToFieldNumber = 2,
     kDistanceFieldNumber = 3,
+    kStopFromIdFieldNumber = 4,
+    kStopToIdFieldNumber = 5,
   };
   // string stop_from = 1;
   void clear_stop_from();
@@ -618,6 +672,24 @@ class Distance final :
   void _internal_set_distance(double value);
   public:
 
+  // uint32 stop_from_id = 4;
+  void clear_stop_from_id();
+  uint32_t stop_from_id() const;
+  void set_stop_from_id(uint32_t value);
+  private:
+  uint32_t _internal_stop_from_id() const;
+  void _internal_set_stop_from_id(uint32_t value);
+  public:
+
+  // uint32 stop_to_id = 5;
+  void clear_stop_to_id();
+  uint32_t stop_to_id() const;
+  void set_stop_to_id(uint32_t value);
+  private:
+  uint32_t _internal_stop_to_id() const;
+  void _internal_set_stop_to_id(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Distance)
  private:
   class _Internal;
@@ -629,6 +701,8 @@ class Distance final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_from_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_to_;
     double distance_;
+    uint32_t stop_from_id_;
+    uint32_t stop_to_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -758,8 +832,14 @@ class Bus final :
 
   enum : int {
     kStopsFieldNumber = 2,
+    kStopIdsFieldNumber = 9,
     kNameFieldNumber = 1,
     kIsRoundtripFieldNumber = 3,
+    kStopCountFieldNumber = 4,
+    kRouteLengthFieldNumber = 6,
+    kUniqueStopCountFieldNumber = 5,
+    kNameIdFieldNumber = 8,
+    kCurvatureFieldNumber = 7,
   };
   // repeated .proto.Stop stops = 2;
   int stops_size() const;
@@ -779,6 +859,28 @@ class Bus final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Stop >&
       stops() const;
 
+  // repeated uint32 stop_ids = 9;
+  int stop_ids_size() const;
+  private:
+  int _internal_stop_ids_size() const;
+  public:
+  void clear_stop_ids();
+  private:
+  uint32_t _internal_stop_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_stop_ids() const;
+  void _internal_add_stop_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_stop_ids();
+  public:
+  uint32_t stop_ids(int index) const;
+  void set_stop_ids(int index, uint32_t value);
+  void add_stop_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      stop_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_stop_ids();
+
   // string name = 1;
   void clear_name();
   const std::string& name() const;
@@ -802,6 +904,51 @@ class Bus final :
   void _internal_set_is_roundtrip(bool value);
   public:
 
+  // uint32 stop_count = 4;
+  void clear_stop_count();
+  uint32_t stop_count() const;
+  void set_stop_count(uint32_t value);
+  private:
+  uint32_t _internal_stop_count() const;
+  void _internal_set_stop_count(uint32_t value);
+  public:
+
+  // double route_length = 6;
+  void clear_route_length();
+  double route_length() const;
+  void set_route_length(double value);
+  private:
+  double _internal_route_length() const;
+  void _internal_set_route_length(double value);
+  public:
+
+  // uint32 unique_stop_count = 5;
+  void clear_unique_stop_count();
+  uint32_t unique_stop_count() const;
+  void set_unique_stop_count(uint32_t value);
+  private:
+  uint32_t _internal_unique_stop_count() const;
+  void _internal_set_unique_stop_count(uint32_t value);
+  public:
+
+  // uint32 name_id = 8;
+  void clear_name_id();
+  uint32_t name_id() const;
+  void set_name_id(uint32_t value);
+  private:
+  uint32_t _internal_name_id() const;
+  void _internal_set_name_id(uint32_t value);
+  public:
+
+  // double curvature = 7;
+  void clear_curvature();
+  double curvature() const;
+  void set_curvature(double value);
+  private:
+  double _internal_curvature() const;
+  void _internal_set_curvature(double value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Bus)
  private:
   class _Internal;
@@ -811,8 +958,15 @@ class Bus final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Stop > stops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > stop_ids_;
+    mutable std::atomic<int> _stop_ids_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     bool is_roundtrip_;
+    uint32_t stop_count_;
+    double route_length_;
+    uint32_t unique_stop_count_;
+    uint32_t name_id_;
+    double curvature_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -944,6 +1098,8 @@ class TransportCatalogue final :
     kStopsFieldNumber = 1,
     kDistancesFieldNumber = 2,
     kBusesFieldNumber = 3,
+    kNamesFieldNumber = 4,
+    kStopIndexFieldNumber = 5,
   };
   // repeated .proto.Stop stops = 1;
   int stops_size() const;
@@ -999,6 +1155,52 @@ class TransportCatalogue final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Bus >&
       buses() const;
 
+  // repeated string names = 4;
+  int names_size() const;
+  private:
+  int _internal_names_size() const;
+  public:
+  void clear_names();
+  const std::string& names(int index) const;
+  std::string* mutable_names(int index);
+  void set_names(int index, const std::string& value);
+  void set_names(int index, std::string&& value);
+  void set_names(int index, const char* value);
+  void set_names(int index, const char* value, size_t size);
+  std::string* add_names();
+  void add_names(const std::string& value);
+  void add_names(std::string&& value);
+  void add_names(const char* value);
+  void add_names(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_names();
+  private:
+  const std::string& _internal_names(int index) const;
+  std::string* _internal_add_names();
+  public:
+
+  // repeated uint32 stop_index = 5;
+  int stop_index_size() const;
+  private:
+  int _internal_stop_index_size() const;
+  public:
+  void clear_stop_index();
+  private:
+  uint32_t _internal_stop_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_stop_index() const;
+  void _internal_add_stop_index(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_stop_index();
+  public:
+  uint32_t stop_index(int index) const;
+  void set_stop_index(int index, uint32_t value);
+  void add_stop_index(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      stop_index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_stop_index();
+
   // @@protoc_insertion_point(class_scope:proto.TransportCatalogue)
  private:
   class _Internal;
@@ -1010,6 +1212,9 @@ class TransportCatalogue final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Stop > stops_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Distance > distances_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Bus > buses_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> names_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > stop_index_;
+    mutable std::atomic<int> _stop_index_cached_byte_size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2164,6 +2369,9 @@ class RoutingSettings final :
   enum : int {
     kBusWaitTimeFieldNumber = 1,
     kBusVelocityFieldNumber = 2,
+    kWalkingVelocityFieldNumber = 4,
+    kRouterTypeFieldNumber = 3,
+    kWalkingStopCountFieldNumber = 5,
   };
   // double bus_wait_time = 1;
   void clear_bus_wait_time();
@@ -2183,6 +2391,33 @@ class RoutingSettings final :
   void _internal_set_bus_velocity(double value);
   public:
 
+  // double walking_velocity = 4;
+  void clear_walking_velocity();
+  double walking_velocity() const;
+  void set_walking_velocity(double value);
+  private:
+  double _internal_walking_velocity() const;
+  void _internal_set_walking_velocity(double value);
+  public:
+
+  // .proto.RouterType router_type = 3;
+  void clear_router_type();
+  ::proto::RouterType router_type() const;
+  void set_router_type(::proto::RouterType value);
+  private:
+  ::proto::RouterType _internal_router_type() const;
+  void _internal_set_router_type(::proto::RouterType value);
+  public:
+
+  // uint32 walking_stop_count = 5;
+  void clear_walking_stop_count();
+  uint32_t walking_stop_count() const;
+  void set_walking_stop_count(uint32_t value);
+  private:
+  uint32_t _internal_walking_stop_count() const;
+  void _internal_set_walking_stop_count(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.RoutingSettings)
  private:
   class _Internal;
@@ -2193,6 +2428,9 @@ class RoutingSettings final :
   struct Impl_ {
     double bus_wait_time_;
     double bus_velocity_;
+    double walking_velocity_;
+    int router_type_;
+    uint32_t walking_stop_count_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2655,6 +2893,7 @@ class Graph final :
   enum : int {
     kEdgesFieldNumber = 1,
     kIncidenceListsFieldNumber = 2,
+    kVertexCountFieldNumber = 3,
   };
   // repeated .proto.Edge edges = 1;
   int edges_size() const;
@@ -2692,6 +2931,15 @@ class Graph final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::IncidenceList >&
       incidence_lists() const;
 
+  // uint32 vertex_count = 3;
+  void clear_vertex_count();
+  uint32_t vertex_count() const;
+  void set_vertex_count(uint32_t value);
+  private:
+  uint32_t _internal_vertex_count() const;
+  void _internal_set_vertex_count(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Graph)
  private:
   class _Internal;
@@ -2702,6 +2950,7 @@ class Graph final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Edge > edges_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::IncidenceList > incidence_lists_;
+    uint32_t vertex_count_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2833,6 +3082,7 @@ class StopVertexId final :
     kNameFieldNumber = 1,
     kStartWaitFieldNumber = 2,
     kEndWaitFieldNumber = 3,
+    kStopIdFieldNumber = 4,
   };
   // string name = 1;
   void clear_name();
@@ -2866,6 +3116,15 @@ class StopVertexId final :
   void _internal_set_end_wait(uint32_t value);
   public:
 
+  // uint32 stop_id = 4;
+  void clear_stop_id();
+  uint32_t stop_id() const;
+  void set_stop_id(uint32_t value);
+  private:
+  uint32_t _internal_stop_id() const;
+  void _internal_set_stop_id(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.StopVertexId)
  private:
   class _Internal;
@@ -2877,6 +3136,7 @@ class StopVertexId final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     uint32_t start_wait_;
     uint32_t end_wait_;
+    uint32_t stop_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3009,6 +3269,7 @@ class EdgeInfo final :
     kEdgeFieldNumber = 1,
     kTimeFieldNumber = 4,
     kSpanCountFieldNumber = 3,
+    kNameIdFieldNumber = 5,
   };
   // string name = 2;
   void clear_name();
@@ -3060,6 +3321,15 @@ class EdgeInfo final :
   void _internal_set_span_count(uint32_t value);
   public:
 
+  // uint32 name_id = 5;
+  void clear_name_id();
+  uint32_t name_id() const;
+  void set_name_id(uint32_t value);
+  private:
+  uint32_t _internal_name_id() const;
+  void _internal_set_name_id(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.EdgeInfo)
  private:
   class _Internal;
@@ -3072,6 +3342,7 @@ class EdgeInfo final :
     ::proto::Edge* edge_;
     double time_;
     uint32_t span_count_;
+    uint32_t name_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3079,24 +3350,24 @@ class EdgeInfo final :
 };
 // -------------------------------------------------------------------
 
-class TransportRouter final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.TransportRouter) */ {
+class RoutesInternalDataRow final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.RoutesInternalDataRow) */ {
  public:
-  inline TransportRouter() : TransportRouter(nullptr) {}
-  ~TransportRouter() override;
-  explicit PROTOBUF_CONSTEXPR TransportRouter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline RoutesInternalDataRow() : RoutesInternalDataRow(nullptr) {}
+  ~RoutesInternalDataRow() override;
+  explicit PROTOBUF_CONSTEXPR RoutesInternalDataRow(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TransportRouter(const TransportRouter& from);
-  TransportRouter(TransportRouter&& from) noexcept
-    : TransportRouter() {
+  RoutesInternalDataRow(const RoutesInternalDataRow& from);
+  RoutesInternalDataRow(RoutesInternalDataRow&& from) noexcept
+    : RoutesInternalDataRow() {
     *this = ::std::move(from);
   }
 
-  inline TransportRouter& operator=(const TransportRouter& from) {
+  inline RoutesInternalDataRow& operator=(const RoutesInternalDataRow& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TransportRouter& operator=(TransportRouter&& from) noexcept {
+  inline RoutesInternalDataRow& operator=(RoutesInternalDataRow&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3119,20 +3390,20 @@ class TransportRouter final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TransportRouter& default_instance() {
+  static const RoutesInternalDataRow& default_instance() {
     return *internal_default_instance();
   }
-  static inline const TransportRouter* internal_default_instance() {
-    return reinterpret_cast<const TransportRouter*>(
-               &_TransportRouter_default_instance_);
+  static inline const RoutesInternalDataRow* internal_default_instance() {
+    return reinterpret_cast<const RoutesInternalDataRow*>(
+               &_RoutesInternalDataRow_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(TransportRouter& a, TransportRouter& b) {
+  friend void swap(RoutesInternalDataRow& a, RoutesInternalDataRow& b) {
     a.Swap(&b);
   }
-  inline void Swap(TransportRouter* other) {
+  inline void Swap(RoutesInternalDataRow* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3145,7 +3416,7 @@ class TransportRouter final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TransportRouter* other) {
+  void UnsafeArenaSwap(RoutesInternalDataRow* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3153,14 +3424,14 @@ class TransportRouter final :
 
   // implements Message ----------------------------------------------
 
-  TransportRouter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<TransportRouter>(arena);
+  RoutesInternalDataRow* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoutesInternalDataRow>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const TransportRouter& from);
+  void CopyFrom(const RoutesInternalDataRow& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const TransportRouter& from) {
-    TransportRouter::MergeImpl(*this, from);
+  void MergeFrom( const RoutesInternalDataRow& from) {
+    RoutesInternalDataRow::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3178,15 +3449,15 @@ class TransportRouter final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TransportRouter* other);
+  void InternalSwap(RoutesInternalDataRow* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.TransportRouter";
+    return "proto.RoutesInternalDataRow";
   }
   protected:
-  explicit TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit RoutesInternalDataRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3200,84 +3471,77 @@ class TransportRouter final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStopVertexIdsFieldNumber = 3,
-    kEdgesInfoFieldNumber = 4,
-    kRoutingSettingsFieldNumber = 1,
-    kGraphFieldNumber = 2,
+    kVertexToFieldNumber = 1,
+    kWeightFieldNumber = 2,
+    kPrevEdgeFieldNumber = 3,
   };
-  // repeated .proto.StopVertexId stop_vertex_ids = 3;
-  int stop_vertex_ids_size() const;
-  private:
-  int _internal_stop_vertex_ids_size() const;
-  public:
-  void clear_stop_vertex_ids();
-  ::proto::StopVertexId* mutable_stop_vertex_ids(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId >*
-      mutable_stop_vertex_ids();
-  private:
-  const ::proto::StopVertexId& _internal_stop_vertex_ids(int index) const;
-  ::proto::StopVertexId* _internal_add_stop_vertex_ids();
-  public:
-  const ::proto::StopVertexId& stop_vertex_ids(int index) const;
-  ::proto::StopVertexId* add_stop_vertex_ids();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId >&
-      stop_vertex_ids() const;
-
-  // repeated .proto.EdgeInfo edges_info = 4;
-  int edges_info_size() const;
+  // repeated uint32 vertex_to = 1;
+  int vertex_to_size() const;
   private:
-  int _internal_edges_info_size() const;
+  int _internal_vertex_to_size() const;
   public:
-  void clear_edges_info();
-  ::proto::EdgeInfo* mutable_edges_info(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo >*
-      mutable_edges_info();
+  void clear_vertex_to();
   private:
-  const ::proto::EdgeInfo& _internal_edges_info(int index) const;
-  ::proto::EdgeInfo* _internal_add_edges_info();
+  uint32_t _internal_vertex_to(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_vertex_to() const;
+  void _internal_add_vertex_to(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_vertex_to();
   public:
-  const ::proto::EdgeInfo& edges_info(int index) const;
-  ::proto::EdgeInfo* add_edges_info();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo >&
-      edges_info() const;
+  uint32_t vertex_to(int index) const;
+  void set_vertex_to(int index, uint32_t value);
+  void add_vertex_to(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      vertex_to() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_vertex_to();
 
-  // .proto.RoutingSettings routing_settings = 1;
-  bool has_routing_settings() const;
+  // repeated double weight = 2;
+  int weight_size() const;
   private:
-  bool _internal_has_routing_settings() const;
+  int _internal_weight_size() const;
   public:
-  void clear_routing_settings();
-  const ::proto::RoutingSettings& routing_settings() const;
-  PROTOBUF_NODISCARD ::proto::RoutingSettings* release_routing_settings();
-  ::proto::RoutingSettings* mutable_routing_settings();
-  void set_allocated_routing_settings(::proto::RoutingSettings* routing_settings);
+  void clear_weight();
   private:
-  const ::proto::RoutingSettings& _internal_routing_settings() const;
-  ::proto::RoutingSettings* _internal_mutable_routing_settings();
+  double _internal_weight(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_weight() const;
+  void _internal_add_weight(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_weight();
   public:
-  void unsafe_arena_set_allocated_routing_settings(
-      ::proto::RoutingSettings* routing_settings);
-  ::proto::RoutingSettings* unsafe_arena_release_routing_settings();
-
-  // .proto.Graph graph = 2;
-  bool has_graph() const;
-  private:
-  bool _internal_has_graph() const;
+  double weight(int index) const;
+  void set_weight(int index, double value);
+  void add_weight(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      weight() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_weight();
+
+  // repeated int64 prev_edge = 3;
+  int prev_edge_size() const;
+  private:
+  int _internal_prev_edge_size() const;
   public:
-  void clear_graph();
-  const ::proto::Graph& graph() const;
-  PROTOBUF_NODISCARD ::proto::Graph* release_graph();
-  ::proto::Graph* mutable_graph();
-  void set_allocated_graph(::proto::Graph* graph);
-  private:
-  const ::proto::Graph& _internal_graph() const;
-  ::proto::Graph* _internal_mutable_graph();
+  void clear_prev_edge();
+  private:
+  int64_t _internal_prev_edge(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_prev_edge() const;
+  void _internal_add_prev_edge(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_prev_edge();
   public:
-  void unsafe_arena_set_allocated_graph(
-      ::proto::Graph* graph);
-  ::proto::Graph* unsafe_arena_release_graph();
-
-  // @@protoc_insertion_point(class_scope:proto.TransportRouter)
+  int64_t prev_edge(int index) const;
+  void set_prev_edge(int index, int64_t value);
+  void add_prev_edge(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      prev_edge() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_prev_edge();
+
+  // @@protoc_insertion_point(class_scope:proto.RoutesInternalDataRow)
  private:
   class _Internal;
 
@@ -3285,10 +3549,11 @@ class TransportRouter final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId > stop_vertex_ids_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo > edges_info_;
-    ::proto::RoutingSettings* routing_settings_;
-    ::proto::Graph* graph_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > vertex_to_;
+    mutable std::atomic<int> _vertex_to_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > weight_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > prev_edge_;
+    mutable std::atomic<int> _prev_edge_cached_byte_size_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3296,24 +3561,24 @@ class TransportRouter final :
 };
 // -------------------------------------------------------------------
 
-class Main final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Main) */ {
+class Shortcut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Shortcut) */ {
  public:
-  inline Main() : Main(nullptr) {}
-  ~Main() override;
-  explicit PROTOBUF_CONSTEXPR Main(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Shortcut() : Shortcut(nullptr) {}
+  ~Shortcut() override;
+  explicit PROTOBUF_CONSTEXPR Shortcut(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Main(const Main& from);
-  Main(Main&& from) noexcept
-    : Main() {
+  Shortcut(const Shortcut& from);
+  Shortcut(Shortcut&& from) noexcept
+    : Shortcut() {
     *this = ::std::move(from);
   }
 
-  inline Main& operator=(const Main& from) {
+  inline Shortcut& operator=(const Shortcut& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Main& operator=(Main&& from) noexcept {
+  inline Shortcut& operator=(Shortcut&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3336,20 +3601,20 @@ class Main final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Main& default_instance() {
+  static const Shortcut& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Main* internal_default_instance() {
-    return reinterpret_cast<const Main*>(
-               &_Main_default_instance_);
+  static inline const Shortcut* internal_default_instance() {
+    return reinterpret_cast<const Shortcut*>(
+               &_Shortcut_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     17;
 
-  friend void swap(Main& a, Main& b) {
+  friend void swap(Shortcut& a, Shortcut& b) {
     a.Swap(&b);
   }
-  inline void Swap(Main* other) {
+  inline void Swap(Shortcut* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3362,7 +3627,7 @@ class Main final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Main* other) {
+  void UnsafeArenaSwap(Shortcut* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3370,14 +3635,14 @@ class Main final :
 
   // implements Message ----------------------------------------------
 
-  Main* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Main>(arena);
+  Shortcut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Shortcut>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Main& from);
+  void CopyFrom(const Shortcut& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Main& from) {
-    Main::MergeImpl(*this, from);
+  void MergeFrom( const Shortcut& from) {
+    Shortcut::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3395,15 +3660,15 @@ class Main final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Main* other);
+  void InternalSwap(Shortcut* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.Main";
+    return "proto.Shortcut";
   }
   protected:
-  explicit Main(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3417,61 +3682,707 @@ class Main final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTransportCatalogueFieldNumber = 1,
-    kRenderSettingsFieldNumber = 2,
-    kTransportRouterFieldNumber = 3,
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+    kWeightFieldNumber = 3,
+    kFirstEdgeFieldNumber = 4,
+    kSecondEdgeFieldNumber = 5,
   };
-  // .proto.TransportCatalogue transport_catalogue = 1;
-  bool has_transport_catalogue() const;
-  private:
-  bool _internal_has_transport_catalogue() const;
-  public:
-  void clear_transport_catalogue();
-  const ::proto::TransportCatalogue& transport_catalogue() const;
-  PROTOBUF_NODISCARD ::proto::TransportCatalogue* release_transport_catalogue();
-  ::proto::TransportCatalogue* mutable_transport_catalogue();
-  void set_allocated_transport_catalogue(::proto::TransportCatalogue* transport_catalogue);
+  // uint32 from = 1;
+  void clear_from();
+  uint32_t from() const;
+  void set_from(uint32_t value);
   private:
-  const ::proto::TransportCatalogue& _internal_transport_catalogue() const;
-  ::proto::TransportCatalogue* _internal_mutable_transport_catalogue();
+  uint32_t _internal_from() const;
+  void _internal_set_from(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_transport_catalogue(
-      ::proto::TransportCatalogue* transport_catalogue);
-  ::proto::TransportCatalogue* unsafe_arena_release_transport_catalogue();
 
-  // .proto.RenderSettings render_settings = 2;
-  bool has_render_settings() const;
+  // uint32 to = 2;
+  void clear_to();
+  uint32_t to() const;
+  void set_to(uint32_t value);
   private:
-  bool _internal_has_render_settings() const;
+  uint32_t _internal_to() const;
+  void _internal_set_to(uint32_t value);
   public:
-  void clear_render_settings();
-  const ::proto::RenderSettings& render_settings() const;
-  PROTOBUF_NODISCARD ::proto::RenderSettings* release_render_settings();
-  ::proto::RenderSettings* mutable_render_settings();
-  void set_allocated_render_settings(::proto::RenderSettings* render_settings);
+
+  // double weight = 3;
+  void clear_weight();
+  double weight() const;
+  void set_weight(double value);
   private:
-  const ::proto::RenderSettings& _internal_render_settings() const;
-  ::proto::RenderSettings* _internal_mutable_render_settings();
+  double _internal_weight() const;
+  void _internal_set_weight(double value);
   public:
-  void unsafe_arena_set_allocated_render_settings(
-      ::proto::RenderSettings* render_settings);
-  ::proto::RenderSettings* unsafe_arena_release_render_settings();
 
-  // .proto.TransportRouter transport_router = 3;
-  bool has_transport_router() const;
+  // uint32 first_edge = 4;
+  void clear_first_edge();
+  uint32_t first_edge() const;
+  void set_first_edge(uint32_t value);
   private:
-  bool _internal_has_transport_router() const;
+  uint32_t _internal_first_edge() const;
+  void _internal_set_first_edge(uint32_t value);
   public:
-  void clear_transport_router();
-  const ::proto::TransportRouter& transport_router() const;
-  PROTOBUF_NODISCARD ::proto::TransportRouter* release_transport_router();
-  ::proto::TransportRouter* mutable_transport_router();
-  void set_allocated_transport_router(::proto::TransportRouter* transport_router);
+
+  // uint32 second_edge = 5;
+  void clear_second_edge();
+  uint32_t second_edge() const;
+  void set_second_edge(uint32_t value);
   private:
-  const ::proto::TransportRouter& _internal_transport_router() const;
-  ::proto::TransportRouter* _internal_mutable_transport_router();
+  uint32_t _internal_second_edge() const;
+  void _internal_set_second_edge(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_transport_router(
+
+  // @@protoc_insertion_point(class_scope:proto.Shortcut)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    uint32_t first_edge_;
+    uint32_t second_edge_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ContractionHierarchy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ContractionHierarchy) */ {
+ public:
+  inline ContractionHierarchy() : ContractionHierarchy(nullptr) {}
+  ~ContractionHierarchy() override;
+  explicit PROTOBUF_CONSTEXPR ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ContractionHierarchy(const ContractionHierarchy& from);
+  ContractionHierarchy(ContractionHierarchy&& from) noexcept
+    : ContractionHierarchy() {
+    *this = ::std::move(from);
+  }
+
+  inline ContractionHierarchy& operator=(const ContractionHierarchy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ContractionHierarchy& operator=(ContractionHierarchy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ContractionHierarchy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContractionHierarchy* internal_default_instance() {
+    return reinterpret_cast<const ContractionHierarchy*>(
+               &_ContractionHierarchy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ContractionHierarchy& a, ContractionHierarchy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ContractionHierarchy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ContractionHierarchy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ContractionHierarchy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContractionHierarchy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContractionHierarchy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContractionHierarchy& from) {
+    ContractionHierarchy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ContractionHierarchy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.ContractionHierarchy";
+  }
+  protected:
+  explicit ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRanksFieldNumber = 1,
+    kShortcutsFieldNumber = 2,
+  };
+  // repeated uint32 ranks = 1;
+  int ranks_size() const;
+  private:
+  int _internal_ranks_size() const;
+  public:
+  void clear_ranks();
+  private:
+  uint32_t _internal_ranks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ranks() const;
+  void _internal_add_ranks(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ranks();
+  public:
+  uint32_t ranks(int index) const;
+  void set_ranks(int index, uint32_t value);
+  void add_ranks(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ranks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ranks();
+
+  // repeated .proto.Shortcut shortcuts = 2;
+  int shortcuts_size() const;
+  private:
+  int _internal_shortcuts_size() const;
+  public:
+  void clear_shortcuts();
+  ::proto::Shortcut* mutable_shortcuts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Shortcut >*
+      mutable_shortcuts();
+  private:
+  const ::proto::Shortcut& _internal_shortcuts(int index) const;
+  ::proto::Shortcut* _internal_add_shortcuts();
+  public:
+  const ::proto::Shortcut& shortcuts(int index) const;
+  ::proto::Shortcut* add_shortcuts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Shortcut >&
+      shortcuts() const;
+
+  // @@protoc_insertion_point(class_scope:proto.ContractionHierarchy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ranks_;
+    mutable std::atomic<int> _ranks_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Shortcut > shortcuts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransportRouter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.TransportRouter) */ {
+ public:
+  inline TransportRouter() : TransportRouter(nullptr) {}
+  ~TransportRouter() override;
+  explicit PROTOBUF_CONSTEXPR TransportRouter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransportRouter(const TransportRouter& from);
+  TransportRouter(TransportRouter&& from) noexcept
+    : TransportRouter() {
+    *this = ::std::move(from);
+  }
+
+  inline TransportRouter& operator=(const TransportRouter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransportRouter& operator=(TransportRouter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransportRouter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransportRouter* internal_default_instance() {
+    return reinterpret_cast<const TransportRouter*>(
+               &_TransportRouter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TransportRouter& a, TransportRouter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransportRouter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransportRouter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransportRouter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransportRouter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransportRouter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransportRouter& from) {
+    TransportRouter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransportRouter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.TransportRouter";
+  }
+  protected:
+  explicit TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStopVertexIdsFieldNumber = 3,
+    kEdgesInfoFieldNumber = 4,
+    kRoutesInternalDataFieldNumber = 5,
+    kRoutingSettingsFieldNumber = 1,
+    kGraphFieldNumber = 2,
+    kContractionHierarchyFieldNumber = 6,
+  };
+  // repeated .proto.StopVertexId stop_vertex_ids = 3;
+  int stop_vertex_ids_size() const;
+  private:
+  int _internal_stop_vertex_ids_size() const;
+  public:
+  void clear_stop_vertex_ids();
+  ::proto::StopVertexId* mutable_stop_vertex_ids(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId >*
+      mutable_stop_vertex_ids();
+  private:
+  const ::proto::StopVertexId& _internal_stop_vertex_ids(int index) const;
+  ::proto::StopVertexId* _internal_add_stop_vertex_ids();
+  public:
+  const ::proto::StopVertexId& stop_vertex_ids(int index) const;
+  ::proto::StopVertexId* add_stop_vertex_ids();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId >&
+      stop_vertex_ids() const;
+
+  // repeated .proto.EdgeInfo edges_info = 4;
+  int edges_info_size() const;
+  private:
+  int _internal_edges_info_size() const;
+  public:
+  void clear_edges_info();
+  ::proto::EdgeInfo* mutable_edges_info(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo >*
+      mutable_edges_info();
+  private:
+  const ::proto::EdgeInfo& _internal_edges_info(int index) const;
+  ::proto::EdgeInfo* _internal_add_edges_info();
+  public:
+  const ::proto::EdgeInfo& edges_info(int index) const;
+  ::proto::EdgeInfo* add_edges_info();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo >&
+      edges_info() const;
+
+  // repeated .proto.RoutesInternalDataRow routes_internal_data = 5;
+  int routes_internal_data_size() const;
+  private:
+  int _internal_routes_internal_data_size() const;
+  public:
+  void clear_routes_internal_data();
+  ::proto::RoutesInternalDataRow* mutable_routes_internal_data(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::RoutesInternalDataRow >*
+      mutable_routes_internal_data();
+  private:
+  const ::proto::RoutesInternalDataRow& _internal_routes_internal_data(int index) const;
+  ::proto::RoutesInternalDataRow* _internal_add_routes_internal_data();
+  public:
+  const ::proto::RoutesInternalDataRow& routes_internal_data(int index) const;
+  ::proto::RoutesInternalDataRow* add_routes_internal_data();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::RoutesInternalDataRow >&
+      routes_internal_data() const;
+
+  // .proto.RoutingSettings routing_settings = 1;
+  bool has_routing_settings() const;
+  private:
+  bool _internal_has_routing_settings() const;
+  public:
+  void clear_routing_settings();
+  const ::proto::RoutingSettings& routing_settings() const;
+  PROTOBUF_NODISCARD ::proto::RoutingSettings* release_routing_settings();
+  ::proto::RoutingSettings* mutable_routing_settings();
+  void set_allocated_routing_settings(::proto::RoutingSettings* routing_settings);
+  private:
+  const ::proto::RoutingSettings& _internal_routing_settings() const;
+  ::proto::RoutingSettings* _internal_mutable_routing_settings();
+  public:
+  void unsafe_arena_set_allocated_routing_settings(
+      ::proto::RoutingSettings* routing_settings);
+  ::proto::RoutingSettings* unsafe_arena_release_routing_settings();
+
+  // .proto.Graph graph = 2;
+  bool has_graph() const;
+  private:
+  bool _internal_has_graph() const;
+  public:
+  void clear_graph();
+  const ::proto::Graph& graph() const;
+  PROTOBUF_NODISCARD ::proto::Graph* release_graph();
+  ::proto::Graph* mutable_graph();
+  void set_allocated_graph(::proto::Graph* graph);
+  private:
+  const ::proto::Graph& _internal_graph() const;
+  ::proto::Graph* _internal_mutable_graph();
+  public:
+  void unsafe_arena_set_allocated_graph(
+      ::proto::Graph* graph);
+  ::proto::Graph* unsafe_arena_release_graph();
+
+  // .proto.ContractionHierarchy contraction_hierarchy = 6;
+  bool has_contraction_hierarchy() const;
+  private:
+  bool _internal_has_contraction_hierarchy() const;
+  public:
+  void clear_contraction_hierarchy();
+  const ::proto::ContractionHierarchy& contraction_hierarchy() const;
+  PROTOBUF_NODISCARD ::proto::ContractionHierarchy* release_contraction_hierarchy();
+  ::proto::ContractionHierarchy* mutable_contraction_hierarchy();
+  void set_allocated_contraction_hierarchy(::proto::ContractionHierarchy* contraction_hierarchy);
+  private:
+  const ::proto::ContractionHierarchy& _internal_contraction_hierarchy() const;
+  ::proto::ContractionHierarchy* _internal_mutable_contraction_hierarchy();
+  public:
+  void unsafe_arena_set_allocated_contraction_hierarchy(
+      ::proto::ContractionHierarchy* contraction_hierarchy);
+  ::proto::ContractionHierarchy* unsafe_arena_release_contraction_hierarchy();
+
+  // @@protoc_insertion_point(class_scope:proto.TransportRouter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::StopVertexId > stop_vertex_ids_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::EdgeInfo > edges_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::RoutesInternalDataRow > routes_internal_data_;
+    ::proto::RoutingSettings* routing_settings_;
+    ::proto::Graph* graph_;
+    ::proto::ContractionHierarchy* contraction_hierarchy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Main final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Main) */ {
+ public:
+  inline Main() : Main(nullptr) {}
+  ~Main() override;
+  explicit PROTOBUF_CONSTEXPR Main(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Main(const Main& from);
+  Main(Main&& from) noexcept
+    : Main() {
+    *this = ::std::move(from);
+  }
+
+  inline Main& operator=(const Main& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Main& operator=(Main&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Main& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Main* internal_default_instance() {
+    return reinterpret_cast<const Main*>(
+               &_Main_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(Main& a, Main& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Main* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Main* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Main* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Main>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Main& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Main& from) {
+    Main::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Main* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Main";
+  }
+  protected:
+  explicit Main(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRenderedMapFieldNumber = 4,
+    kTransportCatalogueFieldNumber = 1,
+    kRenderSettingsFieldNumber = 2,
+    kTransportRouterFieldNumber = 3,
+  };
+  // bytes rendered_map = 4;
+  void clear_rendered_map();
+  const std::string& rendered_map() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rendered_map(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rendered_map();
+  PROTOBUF_NODISCARD std::string* release_rendered_map();
+  void set_allocated_rendered_map(std::string* rendered_map);
+  private:
+  const std::string& _internal_rendered_map() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rendered_map(const std::string& value);
+  std::string* _internal_mutable_rendered_map();
+  public:
+
+  // .proto.TransportCatalogue transport_catalogue = 1;
+  bool has_transport_catalogue() const;
+  private:
+  bool _internal_has_transport_catalogue() const;
+  public:
+  void clear_transport_catalogue();
+  const ::proto::TransportCatalogue& transport_catalogue() const;
+  PROTOBUF_NODISCARD ::proto::TransportCatalogue* release_transport_catalogue();
+  ::proto::TransportCatalogue* mutable_transport_catalogue();
+  void set_allocated_transport_catalogue(::proto::TransportCatalogue* transport_catalogue);
+  private:
+  const ::proto::TransportCatalogue& _internal_transport_catalogue() const;
+  ::proto::TransportCatalogue* _internal_mutable_transport_catalogue();
+  public:
+  void unsafe_arena_set_allocated_transport_catalogue(
+      ::proto::TransportCatalogue* transport_catalogue);
+  ::proto::TransportCatalogue* unsafe_arena_release_transport_catalogue();
+
+  // .proto.RenderSettings render_settings = 2;
+  bool has_render_settings() const;
+  private:
+  bool _internal_has_render_settings() const;
+  public:
+  void clear_render_settings();
+  const ::proto::RenderSettings& render_settings() const;
+  PROTOBUF_NODISCARD ::proto::RenderSettings* release_render_settings();
+  ::proto::RenderSettings* mutable_render_settings();
+  void set_allocated_render_settings(::proto::RenderSettings* render_settings);
+  private:
+  const ::proto::RenderSettings& _internal_render_settings() const;
+  ::proto::RenderSettings* _internal_mutable_render_settings();
+  public:
+  void unsafe_arena_set_allocated_render_settings(
+      ::proto::RenderSettings* render_settings);
+  ::proto::RenderSettings* unsafe_arena_release_render_settings();
+
+  // .proto.TransportRouter transport_router = 3;
+  bool has_transport_router() const;
+  private:
+  bool _internal_has_transport_router() const;
+  public:
+  void clear_transport_router();
+  const ::proto::TransportRouter& transport_router() const;
+  PROTOBUF_NODISCARD ::proto::TransportRouter* release_transport_router();
+  ::proto::TransportRouter* mutable_transport_router();
+  void set_allocated_transport_router(::proto::TransportRouter* transport_router);
+  private:
+  const ::proto::TransportRouter& _internal_transport_router() const;
+  ::proto::TransportRouter* _internal_mutable_transport_router();
+  public:
+  void unsafe_arena_set_allocated_transport_router(
       ::proto::TransportRouter* transport_router);
   ::proto::TransportRouter* unsafe_arena_release_transport_router();
 
@@ -3483,6 +4394,7 @@ class Main final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rendered_map_;
     ::proto::TransportCatalogue* transport_catalogue_;
     ::proto::RenderSettings* render_settings_;
     ::proto::TransportRouter* transport_router_;
@@ -3686,6 +4598,26 @@ inline void Stop::set_allocated_coordinates(::proto::Coordinates* coordinates) {
   // @@protoc_insertion_point(field_set_allocated:proto.Stop.coordinates)
 }
 
+// uint32 name_id = 3;
+inline void Stop::clear_name_id() {
+  _impl_.name_id_ = 0u;
+}
+inline uint32_t Stop::_internal_name_id() const {
+  return _impl_.name_id_;
+}
+inline uint32_t Stop::name_id() const {
+  // @@protoc_insertion_point(field_get:proto.Stop.name_id)
+  return _internal_name_id();
+}
+inline void Stop::_internal_set_name_id(uint32_t value) {
+  
+  _impl_.name_id_ = value;
+}
+inline void Stop::set_name_id(uint32_t value) {
+  _internal_set_name_id(value);
+  // @@protoc_insertion_point(field_set:proto.Stop.name_id)
+}
+
 // -------------------------------------------------------------------
 
 // Distance
@@ -3810,6 +4742,46 @@ inline void Distance::set_distance(double value) {
   // @@protoc_insertion_point(field_set:proto.Distance.distance)
 }
 
+// uint32 stop_from_id = 4;
+inline void Distance::clear_stop_from_id() {
+  _impl_.stop_from_id_ = 0u;
+}
+inline uint32_t Distance::_internal_stop_from_id() const {
+  return _impl_.stop_from_id_;
+}
+inline uint32_t Distance::stop_from_id() const {
+  // @@protoc_insertion_point(field_get:proto.Distance.stop_from_id)
+  return _internal_stop_from_id();
+}
+inline void Distance::_internal_set_stop_from_id(uint32_t value) {
+  
+  _impl_.stop_from_id_ = value;
+}
+inline void Distance::set_stop_from_id(uint32_t value) {
+  _internal_set_stop_from_id(value);
+  // @@protoc_insertion_point(field_set:proto.Distance.stop_from_id)
+}
+
+// uint32 stop_to_id = 5;
+inline void Distance::clear_stop_to_id() {
+  _impl_.stop_to_id_ = 0u;
+}
+inline uint32_t Distance::_internal_stop_to_id() const {
+  return _impl_.stop_to_id_;
+}
+inline uint32_t Distance::stop_to_id() const {
+  // @@protoc_insertion_point(field_get:proto.Distance.stop_to_id)
+  return _internal_stop_to_id();
+}
+inline void Distance::_internal_set_stop_to_id(uint32_t value) {
+  
+  _impl_.stop_to_id_ = value;
+}
+inline void Distance::set_stop_to_id(uint32_t value) {
+  _internal_set_stop_to_id(value);
+  // @@protoc_insertion_point(field_set:proto.Distance.stop_to_id)
+}
+
 // -------------------------------------------------------------------
 
 // Bus
@@ -3924,6 +4896,153 @@ inline void Bus::set_is_roundtrip(bool value) {
   // @@protoc_insertion_point(field_set:proto.Bus.is_roundtrip)
 }
 
+// uint32 stop_count = 4;
+inline void Bus::clear_stop_count() {
+  _impl_.stop_count_ = 0u;
+}
+inline uint32_t Bus::_internal_stop_count() const {
+  return _impl_.stop_count_;
+}
+inline uint32_t Bus::stop_count() const {
+  // @@protoc_insertion_point(field_get:proto.Bus.stop_count)
+  return _internal_stop_count();
+}
+inline void Bus::_internal_set_stop_count(uint32_t value) {
+  
+  _impl_.stop_count_ = value;
+}
+inline void Bus::set_stop_count(uint32_t value) {
+  _internal_set_stop_count(value);
+  // @@protoc_insertion_point(field_set:proto.Bus.stop_count)
+}
+
+// uint32 unique_stop_count = 5;
+inline void Bus::clear_unique_stop_count() {
+  _impl_.unique_stop_count_ = 0u;
+}
+inline uint32_t Bus::_internal_unique_stop_count() const {
+  return _impl_.unique_stop_count_;
+}
+inline uint32_t Bus::unique_stop_count() const {
+  // @@protoc_insertion_point(field_get:proto.Bus.unique_stop_count)
+  return _internal_unique_stop_count();
+}
+inline void Bus::_internal_set_unique_stop_count(uint32_t value) {
+  
+  _impl_.unique_stop_count_ = value;
+}
+inline void Bus::set_unique_stop_count(uint32_t value) {
+  _internal_set_unique_stop_count(value);
+  // @@protoc_insertion_point(field_set:proto.Bus.unique_stop_count)
+}
+
+// double route_length = 6;
+inline void Bus::clear_route_length() {
+  _impl_.route_length_ = 0;
+}
+inline double Bus::_internal_route_length() const {
+  return _impl_.route_length_;
+}
+inline double Bus::route_length() const {
+  // @@protoc_insertion_point(field_get:proto.Bus.route_length)
+  return _internal_route_length();
+}
+inline void Bus::_internal_set_route_length(double value) {
+  
+  _impl_.route_length_ = value;
+}
+inline void Bus::set_route_length(double value) {
+  _internal_set_route_length(value);
+  // @@protoc_insertion_point(field_set:proto.Bus.route_length)
+}
+
+// double curvature = 7;
+inline void Bus::clear_curvature() {
+  _impl_.curvature_ = 0;
+}
+inline double Bus::_internal_curvature() const {
+  return _impl_.curvature_;
+}
+inline double Bus::curvature() const {
+  // @@protoc_insertion_point(field_get:proto.Bus.curvature)
+  return _internal_curvature();
+}
+inline void Bus::_internal_set_curvature(double value) {
+  
+  _impl_.curvature_ = value;
+}
+inline void Bus::set_curvature(double value) {
+  _internal_set_curvature(value);
+  // @@protoc_insertion_point(field_set:proto.Bus.curvature)
+}
+
+// uint32 name_id = 8;
+inline void Bus::clear_name_id() {
+  _impl_.name_id_ = 0u;
+}
+inline uint32_t Bus::_internal_name_id() const {
+  return _impl_.name_id_;
+}
+inline uint32_t Bus::name_id() const {
+  // @@protoc_insertion_point(field_get:proto.Bus.name_id)
+  return _internal_name_id();
+}
+inline void Bus::_internal_set_name_id(uint32_t value) {
+  
+  _impl_.name_id_ = value;
+}
+inline void Bus::set_name_id(uint32_t value) {
+  _internal_set_name_id(value);
+  // @@protoc_insertion_point(field_set:proto.Bus.name_id)
+}
+
+// repeated uint32 stop_ids = 9;
+inline int Bus::_internal_stop_ids_size() const {
+  return _impl_.stop_ids_.size();
+}
+inline int Bus::stop_ids_size() const {
+  return _internal_stop_ids_size();
+}
+inline void Bus::clear_stop_ids() {
+  _impl_.stop_ids_.Clear();
+}
+inline uint32_t Bus::_internal_stop_ids(int index) const {
+  return _impl_.stop_ids_.Get(index);
+}
+inline uint32_t Bus::stop_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Bus.stop_ids)
+  return _internal_stop_ids(index);
+}
+inline void Bus::set_stop_ids(int index, uint32_t value) {
+  _impl_.stop_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Bus.stop_ids)
+}
+inline void Bus::_internal_add_stop_ids(uint32_t value) {
+  _impl_.stop_ids_.Add(value);
+}
+inline void Bus::add_stop_ids(uint32_t value) {
+  _internal_add_stop_ids(value);
+  // @@protoc_insertion_point(field_add:proto.Bus.stop_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Bus::_internal_stop_ids() const {
+  return _impl_.stop_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Bus::stop_ids() const {
+  // @@protoc_insertion_point(field_list:proto.Bus.stop_ids)
+  return _internal_stop_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Bus::_internal_mutable_stop_ids() {
+  return &_impl_.stop_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Bus::mutable_stop_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Bus.stop_ids)
+  return _internal_mutable_stop_ids();
+}
+
 // -------------------------------------------------------------------
 
 // TransportCatalogue
@@ -4048,6 +5167,128 @@ TransportCatalogue::buses() const {
   return _impl_.buses_;
 }
 
+// repeated string names = 4;
+inline int TransportCatalogue::_internal_names_size() const {
+  return _impl_.names_.size();
+}
+inline int TransportCatalogue::names_size() const {
+  return _internal_names_size();
+}
+inline void TransportCatalogue::clear_names() {
+  _impl_.names_.Clear();
+}
+inline std::string* TransportCatalogue::add_names() {
+  std::string* _s = _internal_add_names();
+  // @@protoc_insertion_point(field_add_mutable:proto.TransportCatalogue.names)
+  return _s;
+}
+inline const std::string& TransportCatalogue::_internal_names(int index) const {
+  return _impl_.names_.Get(index);
+}
+inline const std::string& TransportCatalogue::names(int index) const {
+  // @@protoc_insertion_point(field_get:proto.TransportCatalogue.names)
+  return _internal_names(index);
+}
+inline std::string* TransportCatalogue::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.TransportCatalogue.names)
+  return _impl_.names_.Mutable(index);
+}
+inline void TransportCatalogue::set_names(int index, const std::string& value) {
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::set_names(int index, std::string&& value) {
+  _impl_.names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::set_names(int index, const char* value, size_t size) {
+  _impl_.names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto.TransportCatalogue.names)
+}
+inline std::string* TransportCatalogue::_internal_add_names() {
+  return _impl_.names_.Add();
+}
+inline void TransportCatalogue::add_names(const std::string& value) {
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::add_names(std::string&& value) {
+  _impl_.names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::add_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto.TransportCatalogue.names)
+}
+inline void TransportCatalogue::add_names(const char* value, size_t size) {
+  _impl_.names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto.TransportCatalogue.names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TransportCatalogue::names() const {
+  // @@protoc_insertion_point(field_list:proto.TransportCatalogue.names)
+  return _impl_.names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TransportCatalogue::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:proto.TransportCatalogue.names)
+  return &_impl_.names_;
+}
+
+// repeated uint32 stop_index = 5;
+inline int TransportCatalogue::_internal_stop_index_size() const {
+  return _impl_.stop_index_.size();
+}
+inline int TransportCatalogue::stop_index_size() const {
+  return _internal_stop_index_size();
+}
+inline void TransportCatalogue::clear_stop_index() {
+  _impl_.stop_index_.Clear();
+}
+inline uint32_t TransportCatalogue::_internal_stop_index(int index) const {
+  return _impl_.stop_index_.Get(index);
+}
+inline uint32_t TransportCatalogue::stop_index(int index) const {
+  // @@protoc_insertion_point(field_get:proto.TransportCatalogue.stop_index)
+  return _internal_stop_index(index);
+}
+inline void TransportCatalogue::set_stop_index(int index, uint32_t value) {
+  _impl_.stop_index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.TransportCatalogue.stop_index)
+}
+inline void TransportCatalogue::_internal_add_stop_index(uint32_t value) {
+  _impl_.stop_index_.Add(value);
+}
+inline void TransportCatalogue::add_stop_index(uint32_t value) {
+  _internal_add_stop_index(value);
+  // @@protoc_insertion_point(field_add:proto.TransportCatalogue.stop_index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TransportCatalogue::_internal_stop_index() const {
+  return _impl_.stop_index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TransportCatalogue::stop_index() const {
+  // @@protoc_insertion_point(field_list:proto.TransportCatalogue.stop_index)
+  return _internal_stop_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TransportCatalogue::_internal_mutable_stop_index() {
+  return &_impl_.stop_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TransportCatalogue::mutable_stop_index() {
+  // @@protoc_insertion_point(field_mutable_list:proto.TransportCatalogue.stop_index)
+  return _internal_mutable_stop_index();
+}
+
 // -------------------------------------------------------------------
 
 // Point
@@ -5033,13 +6274,73 @@ inline double RoutingSettings::bus_velocity() const {
   // @@protoc_insertion_point(field_get:proto.RoutingSettings.bus_velocity)
   return _internal_bus_velocity();
 }
-inline void RoutingSettings::_internal_set_bus_velocity(double value) {
+inline void RoutingSettings::_internal_set_bus_velocity(double value) {
+  
+  _impl_.bus_velocity_ = value;
+}
+inline void RoutingSettings::set_bus_velocity(double value) {
+  _internal_set_bus_velocity(value);
+  // @@protoc_insertion_point(field_set:proto.RoutingSettings.bus_velocity)
+}
+
+// .proto.RouterType router_type = 3;
+inline void RoutingSettings::clear_router_type() {
+  _impl_.router_type_ = 0;
+}
+inline ::proto::RouterType RoutingSettings::_internal_router_type() const {
+  return static_cast< ::proto::RouterType >(_impl_.router_type_);
+}
+inline ::proto::RouterType RoutingSettings::router_type() const {
+  // @@protoc_insertion_point(field_get:proto.RoutingSettings.router_type)
+  return _internal_router_type();
+}
+inline void RoutingSettings::_internal_set_router_type(::proto::RouterType value) {
+  
+  _impl_.router_type_ = value;
+}
+inline void RoutingSettings::set_router_type(::proto::RouterType value) {
+  _internal_set_router_type(value);
+  // @@protoc_insertion_point(field_set:proto.RoutingSettings.router_type)
+}
+
+// double walking_velocity = 4;
+inline void RoutingSettings::clear_walking_velocity() {
+  _impl_.walking_velocity_ = 0;
+}
+inline double RoutingSettings::_internal_walking_velocity() const {
+  return _impl_.walking_velocity_;
+}
+inline double RoutingSettings::walking_velocity() const {
+  // @@protoc_insertion_point(field_get:proto.RoutingSettings.walking_velocity)
+  return _internal_walking_velocity();
+}
+inline void RoutingSettings::_internal_set_walking_velocity(double value) {
+  
+  _impl_.walking_velocity_ = value;
+}
+inline void RoutingSettings::set_walking_velocity(double value) {
+  _internal_set_walking_velocity(value);
+  // @@protoc_insertion_point(field_set:proto.RoutingSettings.walking_velocity)
+}
+
+// uint32 walking_stop_count = 5;
+inline void RoutingSettings::clear_walking_stop_count() {
+  _impl_.walking_stop_count_ = 0u;
+}
+inline uint32_t RoutingSettings::_internal_walking_stop_count() const {
+  return _impl_.walking_stop_count_;
+}
+inline uint32_t RoutingSettings::walking_stop_count() const {
+  // @@protoc_insertion_point(field_get:proto.RoutingSettings.walking_stop_count)
+  return _internal_walking_stop_count();
+}
+inline void RoutingSettings::_internal_set_walking_stop_count(uint32_t value) {
   
-  _impl_.bus_velocity_ = value;
+  _impl_.walking_stop_count_ = value;
 }
-inline void RoutingSettings::set_bus_velocity(double value) {
-  _internal_set_bus_velocity(value);
-  // @@protoc_insertion_point(field_set:proto.RoutingSettings.bus_velocity)
+inline void RoutingSettings::set_walking_stop_count(uint32_t value) {
+  _internal_set_walking_stop_count(value);
+  // @@protoc_insertion_point(field_set:proto.RoutingSettings.walking_stop_count)
 }
 
 // -------------------------------------------------------------------
@@ -5241,6 +6542,26 @@ Graph::incidence_lists() const {
   return _impl_.incidence_lists_;
 }
 
+// uint32 vertex_count = 3;
+inline void Graph::clear_vertex_count() {
+  _impl_.vertex_count_ = 0u;
+}
+inline uint32_t Graph::_internal_vertex_count() const {
+  return _impl_.vertex_count_;
+}
+inline uint32_t Graph::vertex_count() const {
+  // @@protoc_insertion_point(field_get:proto.Graph.vertex_count)
+  return _internal_vertex_count();
+}
+inline void Graph::_internal_set_vertex_count(uint32_t value) {
+  
+  _impl_.vertex_count_ = value;
+}
+inline void Graph::set_vertex_count(uint32_t value) {
+  _internal_set_vertex_count(value);
+  // @@protoc_insertion_point(field_set:proto.Graph.vertex_count)
+}
+
 // -------------------------------------------------------------------
 
 // StopVertexId
@@ -5335,6 +6656,26 @@ inline void StopVertexId::set_end_wait(uint32_t value) {
   // @@protoc_insertion_point(field_set:proto.StopVertexId.end_wait)
 }
 
+// uint32 stop_id = 4;
+inline void StopVertexId::clear_stop_id() {
+  _impl_.stop_id_ = 0u;
+}
+inline uint32_t StopVertexId::_internal_stop_id() const {
+  return _impl_.stop_id_;
+}
+inline uint32_t StopVertexId::stop_id() const {
+  // @@protoc_insertion_point(field_get:proto.StopVertexId.stop_id)
+  return _internal_stop_id();
+}
+inline void StopVertexId::_internal_set_stop_id(uint32_t value) {
+  
+  _impl_.stop_id_ = value;
+}
+inline void StopVertexId::set_stop_id(uint32_t value) {
+  _internal_set_stop_id(value);
+  // @@protoc_insertion_point(field_set:proto.StopVertexId.stop_id)
+}
+
 // -------------------------------------------------------------------
 
 // EdgeInfo
@@ -5519,6 +6860,366 @@ inline void EdgeInfo::set_time(double value) {
   // @@protoc_insertion_point(field_set:proto.EdgeInfo.time)
 }
 
+// uint32 name_id = 5;
+inline void EdgeInfo::clear_name_id() {
+  _impl_.name_id_ = 0u;
+}
+inline uint32_t EdgeInfo::_internal_name_id() const {
+  return _impl_.name_id_;
+}
+inline uint32_t EdgeInfo::name_id() const {
+  // @@protoc_insertion_point(field_get:proto.EdgeInfo.name_id)
+  return _internal_name_id();
+}
+inline void EdgeInfo::_internal_set_name_id(uint32_t value) {
+  
+  _impl_.name_id_ = value;
+}
+inline void EdgeInfo::set_name_id(uint32_t value) {
+  _internal_set_name_id(value);
+  // @@protoc_insertion_point(field_set:proto.EdgeInfo.name_id)
+}
+
+// -------------------------------------------------------------------
+
+// RoutesInternalDataRow
+
+// repeated uint32 vertex_to = 1;
+inline int RoutesInternalDataRow::_internal_vertex_to_size() const {
+  return _impl_.vertex_to_.size();
+}
+inline int RoutesInternalDataRow::vertex_to_size() const {
+  return _internal_vertex_to_size();
+}
+inline void RoutesInternalDataRow::clear_vertex_to() {
+  _impl_.vertex_to_.Clear();
+}
+inline uint32_t RoutesInternalDataRow::_internal_vertex_to(int index) const {
+  return _impl_.vertex_to_.Get(index);
+}
+inline uint32_t RoutesInternalDataRow::vertex_to(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RoutesInternalDataRow.vertex_to)
+  return _internal_vertex_to(index);
+}
+inline void RoutesInternalDataRow::set_vertex_to(int index, uint32_t value) {
+  _impl_.vertex_to_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.RoutesInternalDataRow.vertex_to)
+}
+inline void RoutesInternalDataRow::_internal_add_vertex_to(uint32_t value) {
+  _impl_.vertex_to_.Add(value);
+}
+inline void RoutesInternalDataRow::add_vertex_to(uint32_t value) {
+  _internal_add_vertex_to(value);
+  // @@protoc_insertion_point(field_add:proto.RoutesInternalDataRow.vertex_to)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutesInternalDataRow::_internal_vertex_to() const {
+  return _impl_.vertex_to_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutesInternalDataRow::vertex_to() const {
+  // @@protoc_insertion_point(field_list:proto.RoutesInternalDataRow.vertex_to)
+  return _internal_vertex_to();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutesInternalDataRow::_internal_mutable_vertex_to() {
+  return &_impl_.vertex_to_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutesInternalDataRow::mutable_vertex_to() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RoutesInternalDataRow.vertex_to)
+  return _internal_mutable_vertex_to();
+}
+
+// repeated double weight = 2;
+inline int RoutesInternalDataRow::_internal_weight_size() const {
+  return _impl_.weight_.size();
+}
+inline int RoutesInternalDataRow::weight_size() const {
+  return _internal_weight_size();
+}
+inline void RoutesInternalDataRow::clear_weight() {
+  _impl_.weight_.Clear();
+}
+inline double RoutesInternalDataRow::_internal_weight(int index) const {
+  return _impl_.weight_.Get(index);
+}
+inline double RoutesInternalDataRow::weight(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RoutesInternalDataRow.weight)
+  return _internal_weight(index);
+}
+inline void RoutesInternalDataRow::set_weight(int index, double value) {
+  _impl_.weight_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.RoutesInternalDataRow.weight)
+}
+inline void RoutesInternalDataRow::_internal_add_weight(double value) {
+  _impl_.weight_.Add(value);
+}
+inline void RoutesInternalDataRow::add_weight(double value) {
+  _internal_add_weight(value);
+  // @@protoc_insertion_point(field_add:proto.RoutesInternalDataRow.weight)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutesInternalDataRow::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutesInternalDataRow::weight() const {
+  // @@protoc_insertion_point(field_list:proto.RoutesInternalDataRow.weight)
+  return _internal_weight();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutesInternalDataRow::_internal_mutable_weight() {
+  return &_impl_.weight_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutesInternalDataRow::mutable_weight() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RoutesInternalDataRow.weight)
+  return _internal_mutable_weight();
+}
+
+// repeated int64 prev_edge = 3;
+inline int RoutesInternalDataRow::_internal_prev_edge_size() const {
+  return _impl_.prev_edge_.size();
+}
+inline int RoutesInternalDataRow::prev_edge_size() const {
+  return _internal_prev_edge_size();
+}
+inline void RoutesInternalDataRow::clear_prev_edge() {
+  _impl_.prev_edge_.Clear();
+}
+inline int64_t RoutesInternalDataRow::_internal_prev_edge(int index) const {
+  return _impl_.prev_edge_.Get(index);
+}
+inline int64_t RoutesInternalDataRow::prev_edge(int index) const {
+  // @@protoc_insertion_point(field_get:proto.RoutesInternalDataRow.prev_edge)
+  return _internal_prev_edge(index);
+}
+inline void RoutesInternalDataRow::set_prev_edge(int index, int64_t value) {
+  _impl_.prev_edge_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.RoutesInternalDataRow.prev_edge)
+}
+inline void RoutesInternalDataRow::_internal_add_prev_edge(int64_t value) {
+  _impl_.prev_edge_.Add(value);
+}
+inline void RoutesInternalDataRow::add_prev_edge(int64_t value) {
+  _internal_add_prev_edge(value);
+  // @@protoc_insertion_point(field_add:proto.RoutesInternalDataRow.prev_edge)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+RoutesInternalDataRow::_internal_prev_edge() const {
+  return _impl_.prev_edge_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+RoutesInternalDataRow::prev_edge() const {
+  // @@protoc_insertion_point(field_list:proto.RoutesInternalDataRow.prev_edge)
+  return _internal_prev_edge();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+RoutesInternalDataRow::_internal_mutable_prev_edge() {
+  return &_impl_.prev_edge_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+RoutesInternalDataRow::mutable_prev_edge() {
+  // @@protoc_insertion_point(field_mutable_list:proto.RoutesInternalDataRow.prev_edge)
+  return _internal_mutable_prev_edge();
+}
+
+// -------------------------------------------------------------------
+
+// Shortcut
+
+// uint32 from = 1;
+inline void Shortcut::clear_from() {
+  _impl_.from_ = 0u;
+}
+inline uint32_t Shortcut::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint32_t Shortcut::from() const {
+  // @@protoc_insertion_point(field_get:proto.Shortcut.from)
+  return _internal_from();
+}
+inline void Shortcut::_internal_set_from(uint32_t value) {
+  
+  _impl_.from_ = value;
+}
+inline void Shortcut::set_from(uint32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:proto.Shortcut.from)
+}
+
+// uint32 to = 2;
+inline void Shortcut::clear_to() {
+  _impl_.to_ = 0u;
+}
+inline uint32_t Shortcut::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint32_t Shortcut::to() const {
+  // @@protoc_insertion_point(field_get:proto.Shortcut.to)
+  return _internal_to();
+}
+inline void Shortcut::_internal_set_to(uint32_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void Shortcut::set_to(uint32_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:proto.Shortcut.to)
+}
+
+// double weight = 3;
+inline void Shortcut::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double Shortcut::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double Shortcut::weight() const {
+  // @@protoc_insertion_point(field_get:proto.Shortcut.weight)
+  return _internal_weight();
+}
+inline void Shortcut::_internal_set_weight(double value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Shortcut::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:proto.Shortcut.weight)
+}
+
+// uint32 first_edge = 4;
+inline void Shortcut::clear_first_edge() {
+  _impl_.first_edge_ = 0u;
+}
+inline uint32_t Shortcut::_internal_first_edge() const {
+  return _impl_.first_edge_;
+}
+inline uint32_t Shortcut::first_edge() const {
+  // @@protoc_insertion_point(field_get:proto.Shortcut.first_edge)
+  return _internal_first_edge();
+}
+inline void Shortcut::_internal_set_first_edge(uint32_t value) {
+  
+  _impl_.first_edge_ = value;
+}
+inline void Shortcut::set_first_edge(uint32_t value) {
+  _internal_set_first_edge(value);
+  // @@protoc_insertion_point(field_set:proto.Shortcut.first_edge)
+}
+
+// uint32 second_edge = 5;
+inline void Shortcut::clear_second_edge() {
+  _impl_.second_edge_ = 0u;
+}
+inline uint32_t Shortcut::_internal_second_edge() const {
+  return _impl_.second_edge_;
+}
+inline uint32_t Shortcut::second_edge() const {
+  // @@protoc_insertion_point(field_get:proto.Shortcut.second_edge)
+  return _internal_second_edge();
+}
+inline void Shortcut::_internal_set_second_edge(uint32_t value) {
+  
+  _impl_.second_edge_ = value;
+}
+inline void Shortcut::set_second_edge(uint32_t value) {
+  _internal_set_second_edge(value);
+  // @@protoc_insertion_point(field_set:proto.Shortcut.second_edge)
+}
+
+// -------------------------------------------------------------------
+
+// ContractionHierarchy
+
+// repeated uint32 ranks = 1;
+inline int ContractionHierarchy::_internal_ranks_size() const {
+  return _impl_.ranks_.size();
+}
+inline int ContractionHierarchy::ranks_size() const {
+  return _internal_ranks_size();
+}
+inline void ContractionHierarchy::clear_ranks() {
+  _impl_.ranks_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_ranks(int index) const {
+  return _impl_.ranks_.Get(index);
+}
+inline uint32_t ContractionHierarchy::ranks(int index) const {
+  // @@protoc_insertion_point(field_get:proto.ContractionHierarchy.ranks)
+  return _internal_ranks(index);
+}
+inline void ContractionHierarchy::set_ranks(int index, uint32_t value) {
+  _impl_.ranks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.ContractionHierarchy.ranks)
+}
+inline void ContractionHierarchy::_internal_add_ranks(uint32_t value) {
+  _impl_.ranks_.Add(value);
+}
+inline void ContractionHierarchy::add_ranks(uint32_t value) {
+  _internal_add_ranks(value);
+  // @@protoc_insertion_point(field_add:proto.ContractionHierarchy.ranks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_ranks() const {
+  return _impl_.ranks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::ranks() const {
+  // @@protoc_insertion_point(field_list:proto.ContractionHierarchy.ranks)
+  return _internal_ranks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_ranks() {
+  return &_impl_.ranks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_ranks() {
+  // @@protoc_insertion_point(field_mutable_list:proto.ContractionHierarchy.ranks)
+  return _internal_mutable_ranks();
+}
+
+// repeated .proto.Shortcut shortcuts = 2;
+inline int ContractionHierarchy::_internal_shortcuts_size() const {
+  return _impl_.shortcuts_.size();
+}
+inline int ContractionHierarchy::shortcuts_size() const {
+  return _internal_shortcuts_size();
+}
+inline void ContractionHierarchy::clear_shortcuts() {
+  _impl_.shortcuts_.Clear();
+}
+inline ::proto::Shortcut* ContractionHierarchy::mutable_shortcuts(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Shortcut >*
+ContractionHierarchy::mutable_shortcuts() {
+  // @@protoc_insertion_point(field_mutable_list:proto.ContractionHierarchy.shortcuts)
+  return &_impl_.shortcuts_;
+}
+inline const ::proto::Shortcut& ContractionHierarchy::_internal_shortcuts(int index) const {
+  return _impl_.shortcuts_.Get(index);
+}
+inline const ::proto::Shortcut& ContractionHierarchy::shortcuts(int index) const {
+  // @@protoc_insertion_point(field_get:proto.ContractionHierarchy.shortcuts)
+  return _internal_shortcuts(index);
+}
+inline ::proto::Shortcut* ContractionHierarchy::_internal_add_shortcuts() {
+  return _impl_.shortcuts_.Add();
+}
+inline ::proto::Shortcut* ContractionHierarchy::add_shortcuts() {
+  ::proto::Shortcut* _add = _internal_add_shortcuts();
+  // @@protoc_insertion_point(field_add:proto.ContractionHierarchy.shortcuts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Shortcut >&
+ContractionHierarchy::shortcuts() const {
+  // @@protoc_insertion_point(field_list:proto.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_;
+}
+
 // -------------------------------------------------------------------
 
 // TransportRouter
@@ -5783,6 +7484,136 @@ TransportRouter::edges_info() const {
   return _impl_.edges_info_;
 }
 
+// repeated .proto.RoutesInternalDataRow routes_internal_data = 5;
+inline int TransportRouter::_internal_routes_internal_data_size() const {
+  return _impl_.routes_internal_data_.size();
+}
+inline int TransportRouter::routes_internal_data_size() const {
+  return _internal_routes_internal_data_size();
+}
+inline void TransportRouter::clear_routes_internal_data() {
+  _impl_.routes_internal_data_.Clear();
+}
+inline ::proto::RoutesInternalDataRow* TransportRouter::mutable_routes_internal_data(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.TransportRouter.routes_internal_data)
+  return _impl_.routes_internal_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::RoutesInternalDataRow >*
+TransportRouter::mutable_routes_internal_data() {
+  // @@protoc_insertion_point(field_mutable_list:proto.TransportRouter.routes_internal_data)
+  return &_impl_.routes_internal_data_;
+}
+inline const ::proto::RoutesInternalDataRow& TransportRouter::_internal_routes_internal_data(int index) const {
+  return _impl_.routes_internal_data_.Get(index);
+}
+inline const ::proto::RoutesInternalDataRow& TransportRouter::routes_internal_data(int index) const {
+  // @@protoc_insertion_point(field_get:proto.TransportRouter.routes_internal_data)
+  return _internal_routes_internal_data(index);
+}
+inline ::proto::RoutesInternalDataRow* TransportRouter::_internal_add_routes_internal_data() {
+  return _impl_.routes_internal_data_.Add();
+}
+inline ::proto::RoutesInternalDataRow* TransportRouter::add_routes_internal_data() {
+  ::proto::RoutesInternalDataRow* _add = _internal_add_routes_internal_data();
+  // @@protoc_insertion_point(field_add:proto.TransportRouter.routes_internal_data)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::RoutesInternalDataRow >&
+TransportRouter::routes_internal_data() const {
+  // @@protoc_insertion_point(field_list:proto.TransportRouter.routes_internal_data)
+  return _impl_.routes_internal_data_;
+}
+
+// .proto.ContractionHierarchy contraction_hierarchy = 6;
+inline bool TransportRouter::_internal_has_contraction_hierarchy() const {
+  return this != internal_default_instance() && _impl_.contraction_hierarchy_ != nullptr;
+}
+inline bool TransportRouter::has_contraction_hierarchy() const {
+  return _internal_has_contraction_hierarchy();
+}
+inline void TransportRouter::clear_contraction_hierarchy() {
+  if (GetArenaForAllocation() == nullptr && _impl_.contraction_hierarchy_ != nullptr) {
+    delete _impl_.contraction_hierarchy_;
+  }
+  _impl_.contraction_hierarchy_ = nullptr;
+}
+inline const ::proto::ContractionHierarchy& TransportRouter::_internal_contraction_hierarchy() const {
+  const ::proto::ContractionHierarchy* p = _impl_.contraction_hierarchy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ContractionHierarchy&>(
+      ::proto::_ContractionHierarchy_default_instance_);
+}
+inline const ::proto::ContractionHierarchy& TransportRouter::contraction_hierarchy() const {
+  // @@protoc_insertion_point(field_get:proto.TransportRouter.contraction_hierarchy)
+  return _internal_contraction_hierarchy();
+}
+inline void TransportRouter::unsafe_arena_set_allocated_contraction_hierarchy(
+    ::proto::ContractionHierarchy* contraction_hierarchy) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.contraction_hierarchy_);
+  }
+  _impl_.contraction_hierarchy_ = contraction_hierarchy;
+  if (contraction_hierarchy) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.TransportRouter.contraction_hierarchy)
+}
+inline ::proto::ContractionHierarchy* TransportRouter::release_contraction_hierarchy() {
+  
+  ::proto::ContractionHierarchy* temp = _impl_.contraction_hierarchy_;
+  _impl_.contraction_hierarchy_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::ContractionHierarchy* TransportRouter::unsafe_arena_release_contraction_hierarchy() {
+  // @@protoc_insertion_point(field_release:proto.TransportRouter.contraction_hierarchy)
+  
+  ::proto::ContractionHierarchy* temp = _impl_.contraction_hierarchy_;
+  _impl_.contraction_hierarchy_ = nullptr;
+  return temp;
+}
+inline ::proto::ContractionHierarchy* TransportRouter::_internal_mutable_contraction_hierarchy() {
+  
+  if (_impl_.contraction_hierarchy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ContractionHierarchy>(GetArenaForAllocation());
+    _impl_.contraction_hierarchy_ = p;
+  }
+  return _impl_.contraction_hierarchy_;
+}
+inline ::proto::ContractionHierarchy* TransportRouter::mutable_contraction_hierarchy() {
+  ::proto::ContractionHierarchy* _msg = _internal_mutable_contraction_hierarchy();
+  // @@protoc_insertion_point(field_mutable:proto.TransportRouter.contraction_hierarchy)
+  return _msg;
+}
+inline void TransportRouter::set_allocated_contraction_hierarchy(::proto::ContractionHierarchy* contraction_hierarchy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.contraction_hierarchy_;
+  }
+  if (contraction_hierarchy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(contraction_hierarchy);
+    if (message_arena != submessage_arena) {
+      contraction_hierarchy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, contraction_hierarchy, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.contraction_hierarchy_ = contraction_hierarchy;
+  // @@protoc_insertion_point(field_set_allocated:proto.TransportRouter.contraction_hierarchy)
+}
+
 // -------------------------------------------------------------------
 
 // Main
@@ -6057,6 +7888,56 @@ inline void Main::set_allocated_transport_router(::proto::TransportRouter* trans
   // @@protoc_insertion_point(field_set_allocated:proto.Main.transport_router)
 }
 
+// bytes rendered_map = 4;
+inline void Main::clear_rendered_map() {
+  _impl_.rendered_map_.ClearToEmpty();
+}
+inline const std::string& Main::rendered_map() const {
+  // @@protoc_insertion_point(field_get:proto.Main.rendered_map)
+  return _internal_rendered_map();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Main::set_rendered_map(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rendered_map_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Main.rendered_map)
+}
+inline std::string* Main::mutable_rendered_map() {
+  std::string* _s = _internal_mutable_rendered_map();
+  // @@protoc_insertion_point(field_mutable:proto.Main.rendered_map)
+  return _s;
+}
+inline const std::string& Main::_internal_rendered_map() const {
+  return _impl_.rendered_map_.Get();
+}
+inline void Main::_internal_set_rendered_map(const std::string& value) {
+  
+  _impl_.rendered_map_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Main::_internal_mutable_rendered_map() {
+  
+  return _impl_.rendered_map_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Main::release_rendered_map() {
+  // @@protoc_insertion_point(field_release:proto.Main.rendered_map)
+  return _impl_.rendered_map_.Release();
+}
+inline void Main::set_allocated_rendered_map(std::string* rendered_map) {
+  if (rendered_map != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rendered_map_.SetAllocated(rendered_map, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rendered_map_.IsDefault()) {
+    _impl_.rendered_map_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Main.rendered_map)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -6094,11 +7975,27 @@ inline void Main::set_allocated_transport_router(::proto::TransportRouter* trans
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace proto
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto::RouterType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto::RouterType>() {
+  return ::proto::RouterType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -1,5 +1,6 @@
 #include "transport_router.h"
 #include <algorithm>
+#include <thread>
 #include <utility>
 
 namespace route {
@@ -21,12 +22,13 @@ Settings TransportRouter::GetSettings()
     return settings_;
 }
 
-void TransportRouter::SetGraph(const Graph& graph)
+void TransportRouter::SetGraph(Graph graph)
 {
-    graph_ = graph;
+    graph_ = std::move(graph);
+    graph_->Freeze();
 }
 
-std::optional<graph::DirectedWeightedGraph<double>> TransportRouter::GetGraph()
+const std::optional<TransportRouter::Graph>& TransportRouter::GetGraph() const
 {
     return graph_;
 }
@@ -81,33 +83,190 @@ void TransportRouter::AddStop(std::string_view stop_name)
 
 void TransportRouter::Build()
 {
+    // Граф, восстановленный из базы, уже содержит все рёбра
     if(!graph_)
     {
         graph_ = Graph(vertex_id_.size() * 2);
+
+        for(const auto& edge_info : edges_info_)
+        {
+            graph_->AddEdge(edge_info.edge);
+        }
     }
+    graph_->Freeze();
 
-    for(const auto& edge_info : edges_info_)
+    switch(settings_.router_type)
     {
-        graph_->AddEdge(edge_info.edge);
+        case RouterType::ALL_PAIRS:
+            // Таблица из плоской базы читается на месте через BlockedRouter
+            if(!router_ && !blocked_router_)
+            {
+                router_.emplace(*graph_);
+            }
+            break;
+        case RouterType::DIJKSTRA:
+            if(!dijkstra_router_)
+            {
+                dijkstra_router_.emplace(*graph_);
+            }
+            break;
+        case RouterType::CONTRACTION_HIERARCHIES:
+            if(!hierarchy_router_)
+            {
+                hierarchy_router_.emplace(*graph_);
+            }
+            break;
+        case RouterType::PARALLEL_ALL_PAIRS:
+            if(!blocked_router_)
+            {
+                const size_t thread_count = settings_.thread_count != 0 ? settings_.thread_count : std::thread::hardware_concurrency();
+                blocked_router_.emplace(*graph_, thread_count);
+            }
+            break;
+        case RouterType::COMPACT_ALL_PAIRS:
+            if(!compact_router_)
+            {
+                const size_t thread_count = settings_.thread_count != 0 ? settings_.thread_count : std::thread::hardware_concurrency();
+                compact_router_.emplace(*graph_, thread_count);
+            }
+            break;
     }
+}
+
+void TransportRouter::SetRoutesInternalData(Route::RoutesInternalData routes_internal_data)
+{
+    router_.emplace(*graph_, std::move(routes_internal_data));
+}
+
+void TransportRouter::SetRoutesInternalData(std::vector<double> weights, std::vector<graph::EdgeId> prev_edges)
+{
+    blocked_router_.emplace(*graph_, std::move(weights), std::move(prev_edges));
+}
+
+void TransportRouter::SetRoutesInternalData(std::vector<float> weights, std::vector<uint32_t> prev_edges)
+{
+    compact_router_.emplace(*graph_, std::move(weights), std::move(prev_edges));
+}
 
-    if(graph_ && !router_)
+void TransportRouter::SetRoutesInternalData(std::shared_ptr<const void> storage, const double* weights, const graph::EdgeId* prev_edges)
+{
+    blocked_router_.emplace(*graph_, std::move(storage), weights, prev_edges);
+}
+
+void TransportRouter::SetRoutesInternalData(std::shared_ptr<const void> storage, const float* weights, const uint32_t* prev_edges)
+{
+    compact_router_.emplace(*graph_, std::move(storage), weights, prev_edges);
+}
+
+std::optional<TransportRouter::Route::RouteInternalData> TransportRouter::GetRouteInternalData(graph::VertexId from, graph::VertexId to) const
+{
+    if(blocked_router_)
     {
-        router_.emplace(Route(*graph_));
+        return blocked_router_->GetRouteInternalData(from, to);
     }
+    if(compact_router_)
+    {
+        return compact_router_->GetRouteInternalData(from, to);
+    }
+
+    return router_->GetRoutesInternalData().at(from).at(to);
 }
 
-std::optional<RouteInfo> TransportRouter::GetRouteInfo(std::string_view from, std::string_view to) const
+void TransportRouter::SetContractionHierarchy(std::vector<size_t> ranks, std::vector<HierarchyRoute::Shortcut> shortcuts)
 {
-    const auto route = router_->BuildRoute(vertex_id_.at(from).start_wait, vertex_id_.at(to).start_wait);
+    hierarchy_router_.emplace(*graph_, std::move(ranks), std::move(shortcuts));
+}
 
-    if(!route)
+const TransportRouter::HierarchyRoute& TransportRouter::GetContractionHierarchy() const
+{
+    return *hierarchy_router_;
+}
+
+const TransportRouter::BlockedRoute& TransportRouter::GetBlockedRouter() const
+{
+    return *blocked_router_;
+}
+
+const TransportRouter::CompactRoute& TransportRouter::GetCompactRouter() const
+{
+    return *compact_router_;
+}
+
+std::optional<TransportRouter::Route::RouteInfo> TransportRouter::BuildRoute(graph::VertexId from, graph::VertexId to) const
+{
+    switch(settings_.router_type)
+    {
+        case RouterType::DIJKSTRA:
+            return dijkstra_router_->BuildRoute(from, to);
+        case RouterType::CONTRACTION_HIERARCHIES:
+            return hierarchy_router_->BuildRoute(from, to);
+        case RouterType::PARALLEL_ALL_PAIRS:
+            return blocked_router_->BuildRoute(from, to);
+        case RouterType::COMPACT_ALL_PAIRS:
+            return compact_router_->BuildRoute(from, to);
+        case RouterType::ALL_PAIRS:
+            break;
+    }
+
+    if(blocked_router_)
+    {
+        return blocked_router_->BuildRoute(from, to);
+    }
+    return router_->BuildRoute(from, to);
+}
+
+std::optional<graph::TerminalRouteInfo<double>> TransportRouter::BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const
+{
+    switch(settings_.router_type)
+    {
+        case RouterType::DIJKSTRA:
+            return dijkstra_router_->BuildRoute(sources, targets);
+        case RouterType::CONTRACTION_HIERARCHIES:
+            return hierarchy_router_->BuildRoute(sources, targets);
+        case RouterType::ALL_PAIRS:
+        case RouterType::PARALLEL_ALL_PAIRS:
+        case RouterType::COMPACT_ALL_PAIRS:
+            break;
+    }
+
+    // У роутеров с таблицей всех пар лучшая пара выбирается по таблице, маршрут восстанавливается только для неё
+    std::optional<double> best_weight;
+    size_t best_source = 0;
+    size_t best_target = 0;
+    for(size_t source = 0; source < sources.size(); ++source)
+    {
+        for(size_t target = 0; target < targets.size(); ++target)
+        {
+            const auto route = GetRouteInternalData(sources[source].vertex, targets[target].vertex);
+            if(!route)
+            {
+                continue;
+            }
+
+            const double weight = sources[source].weight + route->weight + targets[target].weight;
+            if(!best_weight || weight < *best_weight)
+            {
+                best_weight = weight;
+                best_source = source;
+                best_target = target;
+            }
+        }
+    }
+
+    if(!best_weight)
     {
         return std::nullopt;
     }
 
-    std::vector<RouteItem> items;
-    for(const auto id : route->edges)
+    auto route = BuildRoute(sources[best_source].vertex, targets[best_target].vertex);
+    const double weight = sources[best_source].weight + route->weight + targets[best_target].weight;
+
+    return graph::TerminalRouteInfo<double>{best_source, best_target, weight, std::move(route->edges)};
+}
+
+void TransportRouter::AddRouteItems(const std::vector<graph::EdgeId>& edges, std::vector<RouteItem>& items) const
+{
+    for(const auto id : edges)
     {
         const EdgeInfo& edge_info = edges_info_[id];
         RouteItem item;
@@ -122,8 +281,76 @@ std::optional<RouteInfo> TransportRouter::GetRouteInfo(std::string_view from, st
 
         items.push_back(item);
     }
+}
+
+std::optional<RouteInfo> TransportRouter::GetRouteInfo(std::string_view from, std::string_view to) const
+{
+    const auto route = BuildRoute(vertex_id_.at(from).start_wait, vertex_id_.at(to).start_wait);
+
+    if(!route)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<RouteItem> items;
+    AddRouteItems(route->edges, items);
+
+    return RouteInfo{route->weight, items};
+}
+
+std::optional<RouteInfo> TransportRouter::GetRouteInfo(const std::vector<StopAccess>& from, const std::vector<StopAccess>& to) const
+{
+    if(from.empty() || to.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::vector<Terminal> sources;
+    sources.reserve(from.size());
+    for(const auto& access : from)
+    {
+        sources.push_back({vertex_id_.at(access.stop_name).start_wait, access.walk_time});
+    }
+
+    std::vector<Terminal> targets;
+    targets.reserve(to.size());
+    for(const auto& access : to)
+    {
+        targets.push_back({vertex_id_.at(access.stop_name).start_wait, access.walk_time});
+    }
+
+    const auto route = BuildRoute(sources, targets);
+    if(!route)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<RouteItem> items;
+
+    const StopAccess& source = from[route->source];
+    if(source.walk_time > 0)
+    {
+        RouteItem item;
+        item.walk_item = {source.stop_name, source.walk_time};
+        items.push_back(item);
+    }
+
+    AddRouteItems(route->edges, items);
+
+    const StopAccess& target = to[route->target];
+    if(target.walk_time > 0)
+    {
+        RouteItem item;
+        item.walk_item = {target.stop_name, target.walk_time};
+        items.push_back(item);
+    }
 
     return RouteInfo{route->weight, items};
 }
 
+double TransportRouter::ComputeWalkTime(double distance) const
+{
+    return distance / (settings_.walking_velocity * METERS_IN_KILOMETER / MINUTES_IN_HOUR);
+}
+
 } // namespace transport
@@ -2,14 +2,34 @@
 
 #include "domain.h"
 #include "router.h"
+#include "dijkstra_router.h"
+#include "contraction_hierarchy.h"
+#include "blocked_router.h"
+#include <memory>
 #include <unordered_map>
 
 namespace route {
 
+enum class RouterType
+{
+    ALL_PAIRS,
+    DIJKSTRA,
+    CONTRACTION_HIERARCHIES,
+    PARALLEL_ALL_PAIRS,
+    // Таблица всех пар в float и 32-битных id рёбер: в 4 раза меньше памяти, чем у ALL_PAIRS,
+    // total_time считается в double по рёбрам найденного маршрута (см. graph::BlockedRouter)
+    COMPACT_ALL_PAIRS,
+};
+
 struct Settings
 {
     double bus_wait_time;
     double bus_velocity;
+    RouterType router_type = RouterType::ALL_PAIRS;
+    size_t thread_count = 0;
+    // Пешие участки маршрутов между точкой и ближайшими к ней остановками
+    double walking_velocity = 5.0;
+    size_t walking_stop_count = 5;
 };
 
 struct RouteWait
@@ -25,10 +45,18 @@ struct RouteMove
     double time;
 };
 
+// Пешком от точки до остановки или от остановки до точки, без остановки - напрямую между точками
+struct RouteWalk
+{
+    std::string_view stop_name;
+    double time;
+};
+
 struct RouteItem
 {
     std::optional<RouteWait> wait_item;
     std::optional<RouteMove> bus_item;
+    std::optional<RouteWalk> walk_item;
 };
 
 struct EdgeInfo
@@ -45,6 +73,13 @@ struct RouteInfo
     std::vector<RouteItem> items;
 };
 
+// Остановка, с которой маршрут может начаться или на которой закончиться, и время пешком до неё
+struct StopAccess
+{
+    std::string_view stop_name;
+    double walk_time;
+};
+
 struct Vertexe
 {
     size_t start_wait;
@@ -56,6 +91,11 @@ class TransportRouter
 public:
     using Graph = graph::DirectedWeightedGraph<double>;
     using Route = graph::Router<double>;
+    using DijkstraRoute = graph::DijkstraRouter<double>;
+    using HierarchyRoute = graph::ContractionHierarchy<double>;
+    using BlockedRoute = graph::BlockedRouter<double>;
+    using CompactRoute = graph::BlockedRouter<double, float, uint32_t>;
+    using Terminal = graph::RouteTerminal<double>;
 
     TransportRouter() = default;
     explicit TransportRouter(size_t graph_size);
@@ -63,8 +103,8 @@ public:
     void SetSettings(Settings& settings);
     Settings GetSettings();
 
-    void SetGraph(const Graph& graph);
-    std::optional<graph::DirectedWeightedGraph<double>> GetGraph();
+    void SetGraph(Graph graph);
+    const std::optional<Graph>& GetGraph() const;
 
     void SetStopVertexIds(std::unordered_map<std::string_view, Vertexe> stop_vertex_ids);
     const std::unordered_map<std::string_view, Vertexe>& GetStopVertexIds() const;
@@ -78,13 +118,40 @@ public:
 
     void Build();
 
+    void SetRoutesInternalData(Route::RoutesInternalData routes_internal_data);
+    void SetRoutesInternalData(std::vector<double> weights, std::vector<graph::EdgeId> prev_edges);
+    void SetRoutesInternalData(std::vector<float> weights, std::vector<uint32_t> prev_edges);
+    // Матрицы во внешней памяти без копирования, storage держит её, пока жив роутер
+    void SetRoutesInternalData(std::shared_ptr<const void> storage, const double* weights, const graph::EdgeId* prev_edges);
+    void SetRoutesInternalData(std::shared_ptr<const void> storage, const float* weights, const uint32_t* prev_edges);
+    std::optional<Route::RouteInternalData> GetRouteInternalData(graph::VertexId from, graph::VertexId to) const;
+
+    void SetContractionHierarchy(std::vector<size_t> ranks, std::vector<HierarchyRoute::Shortcut> shortcuts);
+    const HierarchyRoute& GetContractionHierarchy() const;
+
+    const BlockedRoute& GetBlockedRouter() const;
+    const CompactRoute& GetCompactRouter() const;
+
     std::optional<RouteInfo> GetRouteInfo(std::string_view from, std::string_view to) const;
+    // Лучший маршрут от любой из остановок from до любой из остановок to с учётом пеших участков
+    std::optional<RouteInfo> GetRouteInfo(const std::vector<StopAccess>& from, const std::vector<StopAccess>& to) const;
+
+    // Время в минутах, за которое проходится distance метров
+    double ComputeWalkTime(double distance) const;
 
 private:
+    std::optional<Route::RouteInfo> BuildRoute(graph::VertexId from, graph::VertexId to) const;
+    std::optional<graph::TerminalRouteInfo<double>> BuildRoute(const std::vector<Terminal>& sources, const std::vector<Terminal>& targets) const;
+    void AddRouteItems(const std::vector<graph::EdgeId>& edges, std::vector<RouteItem>& items) const;
+
     Settings settings_ = {};
 
     std::optional<Graph> graph_ = std::nullopt;
     std::optional<Route> router_ = std::nullopt;
+    std::optional<DijkstraRoute> dijkstra_router_ = std::nullopt;
+    std::optional<HierarchyRoute> hierarchy_router_ = std::nullopt;
+    std::optional<BlockedRoute> blocked_router_ = std::nullopt;
+    std::optional<CompactRoute> compact_router_ = std::nullopt;
 
     std::unordered_map<std::string_view, Vertexe> vertex_id_;
     std::vector<EdgeInfo> edges_info_;
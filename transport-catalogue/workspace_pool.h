@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+// Пул рабочих буферов поиска на vertex_count вершин. Каждый одновременный запрос берёт свой буфер,
+// после запроса буфер возвращается в пул, так что буферов создаётся не больше, чем запросов идёт параллельно
+template <typename Workspace>
+class WorkspacePool
+{
+public:
+    class Lease
+    {
+    public:
+        Lease(WorkspacePool& pool, std::unique_ptr<Workspace> workspace) : pool_(pool), workspace_(std::move(workspace))
+        {
+        }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        ~Lease()
+        {
+            pool_.Release(std::move(workspace_));
+        }
+
+        Workspace& operator*() const
+        {
+            return *workspace_;
+        }
+
+    private:
+        WorkspacePool& pool_;
+        std::unique_ptr<Workspace> workspace_;
+    };
+
+    explicit WorkspacePool(size_t vertex_count) : vertex_count_(vertex_count)
+    {
+    }
+
+    WorkspacePool(const WorkspacePool&) = delete;
+    WorkspacePool& operator=(const WorkspacePool&) = delete;
+
+    Lease Acquire()
+    {
+        {
+            std::lock_guard guard(mutex_);
+            if(!free_.empty())
+            {
+                std::unique_ptr<Workspace> workspace = std::move(free_.back());
+                free_.pop_back();
+                return Lease(*this, std::move(workspace));
+            }
+        }
+
+        return Lease(*this, std::make_unique<Workspace>(vertex_count_));
+    }
+
+private:
+    void Release(std::unique_ptr<Workspace> workspace)
+    {
+        std::lock_guard guard(mutex_);
+        free_.push_back(std::move(workspace));
+    }
+
+    size_t vertex_count_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Workspace>> free_;
+};
+
+}  // namespace graph